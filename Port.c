@@ -19,8 +19,16 @@
 /* Port driver header file */
 #include "Port.h"
 
-/* Port registers header file */
+/*
+ * Port registers header file. A host build can define PORT_REGS_HEADER to
+ * substitute a simulated register file, which may also provide its own
+ * PORT_REG / PORT_BITBAND_REG to count every register access.
+ */
+#ifdef PORT_REGS_HEADER
+#include PORT_REGS_HEADER
+#else
 #include "Port_Regs.h"
+#endif
 
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
 
@@ -34,6 +42,235 @@
 
 #endif
 
+/******************************************************************************
+ *  LOCAL MACROS
+ ******************************************************************************/
+
+/* Access a GPIO register given the port base address and the register offset */
+#ifndef PORT_REG
+#define PORT_REG(BASE, OFFSET)      (*(volatile uint32*)((volatile uint8*)(BASE) + (OFFSET)))
+#endif
+
+/*
+ * Replace the MASK bits of a GPIO register with VALUE in a read-modify-write
+ * that a preempting ISR updating other bits of the register cannot corrupt
+ */
+#define PORT_REG_UPDATE(BASE, OFFSET, MASK, VALUE) \
+    Port_AtomicUpdate(&PORT_REG(BASE, OFFSET), (uint32)(MASK), (uint32)(VALUE))
+
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+/*
+ * Replace the MASK bits of a GPIO register from its SRAM shadow: a single
+ * store, no read back. The shadow update and the store share one PRIMASK
+ * section, so a preempting ISR changing the same port cannot lose an update.
+ */
+#define PORT_REG_MODIFY(BASE, OFFSET, SHADOW, MASK, VALUE) \
+    do \
+    { \
+        uint32 Port_ShadowPrimask; \
+        PORT_ENTER_CRITICAL(Port_ShadowPrimask); \
+        PORT_REG(BASE, OFFSET) = ((SHADOW) = ((SHADOW) & ~(MASK)) | (VALUE)); \
+        PORT_EXIT_CRITICAL(Port_ShadowPrimask); \
+    } while (0)
+#else
+#define PORT_REG_MODIFY(BASE, OFFSET, SHADOW, MASK, VALUE) \
+    PORT_REG_UPDATE(BASE, OFFSET, MASK, VALUE)
+#endif
+
+/*
+ * Bit-band alias of bit BIT of a GPIO register: a store to the alias word
+ * sets or clears that single bit atomically, without a read-modify-write
+ */
+#ifndef PORT_BITBAND_REG
+#define PORT_BITBAND_REG(BASE, OFFSET, BIT) \
+    (*(volatile uint32*)(PERIPHERAL_BITBAND_BASE_ADDRESS \
+        + (((uint32)(BASE) + (OFFSET) - PERIPHERAL_BASE_ADDRESS) * 32U) + ((uint32)(BIT) * 4U)))
+#endif
+
+/* Attributes of a pin mode in Port_ModeAttributes */
+#define PORT_MODE_DEN               (0x01U)     /* Digital enable */
+#define PORT_MODE_AFSEL             (0x02U)     /* Alternate function select */
+#define PORT_MODE_AMSEL             (0x04U)     /* Analog mode select */
+
+/* Modes below this value have a PCTL encoding in Port_PinModesType.Ctl */
+#define PORT_CTL_MODES              (8U)
+
+/* Mode capability and PCTL encoding of one mode in Port_PinModes */
+#define PORT_MODE(MODE)             ((uint16)(1U << (MODE)))
+#define PORT_CTL(MODE, VALUE)       ((uint32)(VALUE) << ((MODE) * 4U))
+
+#if (PORT_STATISTICS_API == STD_ON)
+/* Timestamp an API on entry, and record its duration on its normal exit */
+#define PORT_STATISTICS_START()     uint32 Port_StartCycles = DWT_CYCCNT_REG
+#define PORT_STATISTICS_STOP(SID)   Port_RecordCycles((SID), DWT_CYCCNT_REG - Port_StartCycles)
+#else
+#define PORT_STATISTICS_START()
+#define PORT_STATISTICS_STOP(SID)
+#endif
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON) && (PORT_DEFERRED_ERROR_REPORT == STD_ON)
+/* Runtime services with deferred errors (IDs 0x00 up to this value - 1) and their error codes */
+#define PORT_DEFERRED_SERVICES      (7U)
+#define PORT_DEFERRED_ERROR_CODES   (PORT_E_PARAM_POINTER - PORT_E_PARAM_PIN + 1U)
+#define PORT_DEFERRED_ERRORS        (PORT_DEFERRED_SERVICES * PORT_DEFERRED_ERROR_CODES)
+
+/* Report an error of a runtime service: one counter increment, reported later by Port_MainFunction */
+#define PORT_RUNTIME_ERROR(SID, ERROR) \
+    Port_PostError(((uint32)(SID) * PORT_DEFERRED_ERROR_CODES) + ((uint32)(ERROR) - PORT_E_PARAM_PIN))
+#else
+#define PORT_RUNTIME_ERROR(SID, ERROR) \
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, (SID), (ERROR))
+#endif
+
+#if (PORT_TRACE_API == STD_ON)
+/* Record a pin configuration change in the trace ring buffer */
+#define PORT_TRACE(SID, PIN, OLD, NEW)  Port_TraceEvent((SID), (PIN), (uint8)(OLD), (uint8)(NEW))
+#else
+#define PORT_TRACE(SID, PIN, OLD, NEW)
+#endif
+
+#if (PORT_STREAM_API == STD_ON)
+/* uDMA channels, channel assignments and items of one basic transfer */
+#define PORT_DMA_CHANNELS           (32U)
+#define PORT_DMA_ENCODINGS          (5U)
+#define PORT_DMA_MAX_TRANSFER       (1024U)
+
+/*
+ * Control word of a stream: byte source incremented, byte destination not
+ * incremented, one item per request, basic transfer of LENGTH items
+ */
+#define PORT_DMA_STREAM_CONTROL(LENGTH) \
+    ((0x3U << 30U) | (((uint32)(LENGTH) - 1U) << 4U) | 0x1U)
+#endif
+
+/*
+ * Short critical section masking the interrupts through PRIMASK, restored to
+ * its previous state on exit. Compilers without GCC-style inline assembly
+ * for ARMv7-M do not mask anything.
+ */
+#if defined(__GNUC__) && (defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__))
+#define PORT_ENTER_CRITICAL(STATE)  __asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (STATE) : : "memory")
+#define PORT_EXIT_CRITICAL(STATE)   __asm volatile ("msr primask, %0" : : "r" (STATE) : "memory")
+#else
+#define PORT_ENTER_CRITICAL(STATE)  ((STATE) = 0U)
+#define PORT_EXIT_CRITICAL(STATE)   ((void)(STATE))
+#endif
+
+/* Bits of the NEW image of a register that differ from the OLD image (or that OLD did not own) */
+#define PORT_CHANGED_BITS(OLD_MASK, OLD_VALUE, NEW_MASK, NEW_VALUE) \
+    ((NEW_MASK) & ~((OLD_MASK) & ~((OLD_VALUE) ^ (NEW_VALUE))))
+
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+/* Same for a shadowed register, compared with its shadow so the runtime changes are undone too */
+#define PORT_SHADOW_CHANGED_BITS(OLD_MASK, OLD_VALUE, SHADOW, NEW_MASK, NEW_VALUE) \
+    ((NEW_MASK) & ((SHADOW) ^ (NEW_VALUE)))
+#else
+#define PORT_SHADOW_CHANGED_BITS(OLD_MASK, OLD_VALUE, SHADOW, NEW_MASK, NEW_VALUE) \
+    PORT_CHANGED_BITS(OLD_MASK, OLD_VALUE, NEW_MASK, NEW_VALUE)
+#endif
+
+#if (PORT_INTERRUPT_API == STD_ON)
+/*
+ * Highest pin set in a non-zero interrupt status: a single CLZ instruction
+ * with GCC-compatible compilers, a nibble lookup otherwise
+ */
+#if defined(__GNUC__)
+#define PORT_HIGHEST_PIN(STATUS)    (31U - (uint32)__builtin_clz(STATUS))
+#else
+#define PORT_HIGHEST_PIN(STATUS)    Port_HighestPin(STATUS)
+#endif
+#endif
+
+/* Key written to GPIOLOCK to unlock the GPIOCR register */
+#define PORT_GPIO_UNLOCK_KEY        (0x4C4F434BU)
+
+#if (PORT_DEVICE_TM4C129 == STD_ON)
+/* NVIC_EN registers covering the GPIO interrupts (up to PORTQ, interrupt 84) */
+#define PORT_NVIC_EN_REGS           (3U)
+
+/* Ports whose pins share one summary interrupt once GPIOSI.SUM is set (PORTP, PORTQ) */
+#define PORT_SUMMARY_INTERRUPT_PORTS ((1U << 13U) | (1U << 14U))
+#else
+/* NVIC_EN registers covering the GPIO interrupts (up to PORTF, interrupt 30) */
+#define PORT_NVIC_EN_REGS           (1U)
+#endif
+
+/******************************************************************************
+ *  LOCAL TYPES
+ ******************************************************************************/
+
+/* Execution time accumulated for one service */
+typedef struct
+{
+    uint32 Count;
+    uint32 MinCycles;
+    uint32 MaxCycles;
+    uint64 TotalCycles;
+} Port_CyclesType;
+
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+/* Last value written to the runtime-configurable registers of one port */
+typedef struct
+{
+    uint8 Dir;
+    uint8 DigitalEnable;
+    uint8 AltFunc;
+    uint8 AnalogMode;
+    uint8 OpenDrain;
+    uint32 Ctl;
+} Port_ShadowType;
+#endif
+
+#if (PORT_STREAM_API == STD_ON)
+/* Primary control structure of one uDMA channel */
+typedef struct
+{
+    uint32 SrcEnd;                  /* Address of the last source item */
+    uint32 DstEnd;                  /* Address of the last destination item */
+    uint32 Control;
+    uint32 Reserved;
+} Port_DmaControlType;
+#endif
+
+/* Modes supported by one pin and how to select them */
+typedef struct
+{
+    uint16 Modes;           /* Bit m set => mode m is supported */
+    uint16 OpenDrainModes;  /* Bit m set => mode m needs an open-drain output */
+    uint32 Ctl;             /* Nibble m => PCTL value of mode m (m < PORT_CTL_MODES) */
+} Port_PinModesType;
+
+/******************************************************************************
+ *  LOCAL FUNCTION PROTOTYPES
+ ******************************************************************************/
+
+static void Port_CommitImage(Port_PortType Port, const Port_PortImageType* Image);
+static void Port_SwitchImage(Port_PortType Port, const Port_PortImageType* Old, const Port_PortImageType* New);
+static uint32 Port_CtlMask(uint8 PinMask);
+static void Port_AtomicUpdate(volatile uint32* Reg_Ptr, uint32 Mask, uint32 Value);
+static Std_ReturnType Port_ApplyMode(volatile uint32* PortGpio_Ptr, Port_PortType Port, uint8 PinMask, Port_PinModeType Mode);
+static uint32 Port_VerifyRegister(volatile uint32* PortGpio_Ptr, uint32 Offset, uint32 Mask, uint32 Expected, uint32 Drift);
+static Std_ReturnType Port_CheckPinImage(const Port_PortImageType* Image, Port_PortType Port, uint8 PinNum, const Port_ConfigChannel* Channel);
+#if (PORT_STATISTICS_API == STD_ON)
+static void Port_RecordCycles(uint8 ServiceId, uint32 Cycles);
+#endif
+#if (PORT_DEV_ERROR_DETECT == STD_ON) && (PORT_DEFERRED_ERROR_REPORT == STD_ON)
+static void Port_PostError(uint32 Entry);
+#endif
+#if (PORT_CONFIGURED_PARALLEL_BUSES > 0U)
+static void Port_ResolveParallelBuses(const Port_ConfigType* ConfigPtr, uint8 ServiceId);
+#endif
+#if (PORT_TRACE_API == STD_ON)
+static void Port_TraceEvent(uint8 ServiceId, Port_PinType Pin, uint8 OldValue, uint8 NewValue);
+#endif
+#if (PORT_INTERRUPT_API == STD_ON)
+static void Port_EnableInterruptLines(const Port_ConfigType* ConfigPtr);
+static void Port_DispatchInterrupts(Port_PortType Port);
+#if !defined(__GNUC__)
+static uint32 Port_HighestPin(uint32 Status);
+#endif
+#endif
+
 /******************************************************************************
  *  STATIC VARIABLES
  ******************************************************************************/
@@ -44,6 +281,384 @@ static uint8 Port_Status = PORT_NOT_INITIALIZED;
 /* A global variable holds the Configuration of the Port driver */
 static const Port_ConfigType* Port_ConfigPtr = NULL_PTR;
 
+#if (PORT_STATISTICS_API == STD_ON)
+/* Execution time of every service, indexed by the service ID */
+static Port_CyclesType Port_Cycles[PORT_STATISTICS_SERVICES];
+#endif
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON) && (PORT_DEFERRED_ERROR_REPORT == STD_ON)
+/*
+ * Deferred errors, indexed by service ID then error code: the services only
+ * increment Port_ErrorPosted (Port_PostError), only Port_MainFunction writes
+ * Port_ErrorReported, and an entry is pending while the two differ
+ */
+static volatile uint16 Port_ErrorPosted[PORT_DEFERRED_ERRORS];
+static uint16 Port_ErrorReported[PORT_DEFERRED_ERRORS];
+
+/* Next entry examined by Port_MainFunction, so no pending error is starved */
+static uint8 Port_ErrorScan = 0U;
+#endif
+
+#if (PORT_TRACE_API == STD_ON)
+/*
+ * Trace ring buffer: Port_TraceHead is only written by the traced services,
+ * Port_TraceTail only by Port_ReadTrace, so neither side needs a lock
+ */
+static volatile Port_TraceRecordType Port_TraceBuffer[PORT_TRACE_BUFFER_SIZE];
+static volatile uint32 Port_TraceHead = 0U;
+static volatile uint32 Port_TraceTail = 0U;
+
+/* Records dropped because the buffer was full */
+static volatile uint32 Port_TraceLost = 0U;
+
+/* Current mode of every configured channel, the old value of a mode record */
+static Port_PinModeType Port_TraceModes[PORT_CONFIGURED_CHANNELS];
+#endif
+
+#if (PORT_STREAM_API == STD_ON)
+/*
+ * uDMA control table installed by Port_StartStream when no other driver has
+ * enabled the controller yet (primary structures only, 1024-byte aligned)
+ */
+static Port_DmaControlType Port_DmaControlTable[PORT_DMA_CHANNELS] __attribute__((aligned(1024)));
+#endif
+
+/* Register bits needed by every mode, indexed by the mode */
+static const uint8 Port_ModeAttributes[PORT_NUMBER_OF_MODES] =
+{
+    PORT_MODE_DEN,                      /* PIN_MODE_DIO   */
+    PORT_MODE_DEN | PORT_MODE_AFSEL,    /* PIN_MODE_UART  */
+    PORT_MODE_DEN | PORT_MODE_AFSEL,    /* PIN_MODE_SSI   */
+    PORT_MODE_DEN | PORT_MODE_AFSEL,    /* PIN_MODE_I2C   */
+    PORT_MODE_DEN | PORT_MODE_AFSEL,    /* PIN_MODE_M0PWM */
+    PORT_MODE_DEN | PORT_MODE_AFSEL,    /* PIN_MODE_M1PWM */
+    PORT_MODE_DEN | PORT_MODE_AFSEL,    /* PIN_MODE_CAN   */
+    PORT_MODE_DEN | PORT_MODE_AFSEL,    /* PIN_MODE_QEI   */
+    PORT_MODE_AFSEL | PORT_MODE_AMSEL   /* PIN_MODE_ADC   */
+};
+
+#define PORT_DIO_ONLY               { PORT_MODE(PIN_MODE_DIO), 0U, 0U }
+#define PORT_DIO_ADC                { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_ADC), 0U, 0U }
+#define PORT_NOT_BONDED             { 0U, 0U, 0U }
+
+#if (PORT_DEVICE_TM4C129 == STD_ON)
+/*
+ * Mode capability table of the TM4C1294NCPDT, indexed by port then pin.
+ * Only the digital I/O and the analog inputs are described: the PCTL encodings
+ * of its other peripherals differ from the TM4C123 ones and are not tabulated,
+ * so these modes are rejected by Port_ValidateConfig and the generator.
+ */
+static const Port_PinModesType Port_PinModes[PORT_NUMBER_OF_PORTS][8] =
+{
+    {   /* PORTA */
+        PORT_DIO_ONLY, PORT_DIO_ONLY, PORT_DIO_ONLY, PORT_DIO_ONLY,
+        PORT_DIO_ONLY, PORT_DIO_ONLY, PORT_DIO_ONLY, PORT_DIO_ONLY
+    },
+    {   /* PORTB: PB4, PB5 = AIN10, AIN11, PB6, PB7 not bonded */
+        PORT_DIO_ONLY, PORT_DIO_ONLY, PORT_DIO_ONLY, PORT_DIO_ONLY,
+        PORT_DIO_ADC, PORT_DIO_ADC, PORT_NOT_BONDED, PORT_NOT_BONDED
+    },
+    {   /* PORTC: PC0..PC3 = JTAG/SWD */
+        PORT_DIO_ONLY, PORT_DIO_ONLY, PORT_DIO_ONLY, PORT_DIO_ONLY,
+        PORT_DIO_ONLY, PORT_DIO_ONLY, PORT_DIO_ONLY, PORT_DIO_ONLY
+    },
+    {   /* PORTD: PD0..PD3 = AIN15..AIN12, PD4..PD7 = AIN7..AIN4 */
+        PORT_DIO_ADC, PORT_DIO_ADC, PORT_DIO_ADC, PORT_DIO_ADC,
+        PORT_DIO_ADC, PORT_DIO_ADC, PORT_DIO_ADC, PORT_DIO_ADC
+    },
+    {   /* PORTE: PE0..PE3 = AIN3..AIN0, PE4, PE5 = AIN9, AIN8, PE6, PE7 not bonded */
+        PORT_DIO_ADC, PORT_DIO_ADC, PORT_DIO_ADC, PORT_DIO_ADC,
+        PORT_DIO_ADC, PORT_DIO_ADC, PORT_NOT_BONDED, PORT_NOT_BONDED
+    },
+    {   /* PORTF: PF5..PF7 not bonded */
+        PORT_DIO_ONLY, PORT_DIO_ONLY, PORT_DIO_ONLY, PORT_DIO_ONLY,
+        PORT_DIO_ONLY, PORT_NOT_BONDED, PORT_NOT_BONDED, PORT_NOT_BONDED
+    },
+    {   /* PORTG: PG2..PG7 not bonded */
+        PORT_DIO_ONLY, PORT_DIO_ONLY, PORT_NOT_BONDED, PORT_NOT_BONDED,
+        PORT_NOT_BONDED, PORT_NOT_BONDED, PORT_NOT_BONDED, PORT_NOT_BONDED
+    },
+    {   /* PORTH: PH4..PH7 not bonded */
+        PORT_DIO_ONLY, PORT_DIO_ONLY, PORT_DIO_ONLY, PORT_DIO_ONLY,
+        PORT_NOT_BONDED, PORT_NOT_BONDED, PORT_NOT_BONDED, PORT_NOT_BONDED
+    },
+    {   /* PORTJ: PJ2..PJ7 not bonded */
+        PORT_DIO_ONLY, PORT_DIO_ONLY, PORT_NOT_BONDED, PORT_NOT_BONDED,
+        PORT_NOT_BONDED, PORT_NOT_BONDED, PORT_NOT_BONDED, PORT_NOT_BONDED
+    },
+    {   /* PORTK: PK0..PK3 = AIN16..AIN19 */
+        PORT_DIO_ADC, PORT_DIO_ADC, PORT_DIO_ADC, PORT_DIO_ADC,
+        PORT_DIO_ONLY, PORT_DIO_ONLY, PORT_DIO_ONLY, PORT_DIO_ONLY
+    },
+    {   /* PORTL */
+        PORT_DIO_ONLY, PORT_DIO_ONLY, PORT_DIO_ONLY, PORT_DIO_ONLY,
+        PORT_DIO_ONLY, PORT_DIO_ONLY, PORT_DIO_ONLY, PORT_DIO_ONLY
+    },
+    {   /* PORTM */
+        PORT_DIO_ONLY, PORT_DIO_ONLY, PORT_DIO_ONLY, PORT_DIO_ONLY,
+        PORT_DIO_ONLY, PORT_DIO_ONLY, PORT_DIO_ONLY, PORT_DIO_ONLY
+    },
+    {   /* PORTN: PN6, PN7 not bonded */
+        PORT_DIO_ONLY, PORT_DIO_ONLY, PORT_DIO_ONLY, PORT_DIO_ONLY,
+        PORT_DIO_ONLY, PORT_DIO_ONLY, PORT_NOT_BONDED, PORT_NOT_BONDED
+    },
+    {   /* PORTP: PP6, PP7 not bonded */
+        PORT_DIO_ONLY, PORT_DIO_ONLY, PORT_DIO_ONLY, PORT_DIO_ONLY,
+        PORT_DIO_ONLY, PORT_DIO_ONLY, PORT_NOT_BONDED, PORT_NOT_BONDED
+    },
+    {   /* PORTQ: PQ5..PQ7 not bonded */
+        PORT_DIO_ONLY, PORT_DIO_ONLY, PORT_DIO_ONLY, PORT_DIO_ONLY,
+        PORT_DIO_ONLY, PORT_NOT_BONDED, PORT_NOT_BONDED, PORT_NOT_BONDED
+    }
+};
+#else
+/*
+ * Mode capability table of the TM4C123GH6PM, indexed by port then pin.
+ * Where a pin offers two instances of a peripheral (PC4/PC5 UART4/UART1,
+ * PD0..PD3 SSI3/SSI1) the instance with the lowest PCTL value is used.
+ */
+static const Port_PinModesType Port_PinModes[PORT_NUMBER_OF_PORTS][8] =
+{
+    {   /* PORTA */
+        /* PA0: U0Rx, CAN1Rx */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_UART) | PORT_MODE(PIN_MODE_CAN), 0U,
+          PORT_CTL(PIN_MODE_UART, 1U) | PORT_CTL(PIN_MODE_CAN, 8U) },
+        /* PA1: U0Tx, CAN1Tx */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_UART) | PORT_MODE(PIN_MODE_CAN), 0U,
+          PORT_CTL(PIN_MODE_UART, 1U) | PORT_CTL(PIN_MODE_CAN, 8U) },
+        /* PA2: SSI0Clk */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_SSI), 0U, PORT_CTL(PIN_MODE_SSI, 2U) },
+        /* PA3: SSI0Fss */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_SSI), 0U, PORT_CTL(PIN_MODE_SSI, 2U) },
+        /* PA4: SSI0Rx */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_SSI), 0U, PORT_CTL(PIN_MODE_SSI, 2U) },
+        /* PA5: SSI0Tx */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_SSI), 0U, PORT_CTL(PIN_MODE_SSI, 2U) },
+        /* PA6: I2C1SCL, M1PWM2 */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_I2C) | PORT_MODE(PIN_MODE_M1PWM), 0U,
+          PORT_CTL(PIN_MODE_I2C, 3U) | PORT_CTL(PIN_MODE_M1PWM, 5U) },
+        /* PA7: I2C1SDA, M1PWM3 */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_I2C) | PORT_MODE(PIN_MODE_M1PWM), PORT_MODE(PIN_MODE_I2C),
+          PORT_CTL(PIN_MODE_I2C, 3U) | PORT_CTL(PIN_MODE_M1PWM, 5U) }
+    },
+    {   /* PORTB */
+        /* PB0: U1Rx */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_UART), 0U, PORT_CTL(PIN_MODE_UART, 1U) },
+        /* PB1: U1Tx */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_UART), 0U, PORT_CTL(PIN_MODE_UART, 1U) },
+        /* PB2: I2C0SCL */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_I2C), 0U, PORT_CTL(PIN_MODE_I2C, 3U) },
+        /* PB3: I2C0SDA */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_I2C), PORT_MODE(PIN_MODE_I2C), PORT_CTL(PIN_MODE_I2C, 3U) },
+        /* PB4: AIN10, SSI2Clk, M0PWM2, CAN0Rx */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_ADC) | PORT_MODE(PIN_MODE_SSI) | PORT_MODE(PIN_MODE_M0PWM)
+          | PORT_MODE(PIN_MODE_CAN), 0U,
+          PORT_CTL(PIN_MODE_SSI, 2U) | PORT_CTL(PIN_MODE_M0PWM, 4U) | PORT_CTL(PIN_MODE_CAN, 8U) },
+        /* PB5: AIN11, SSI2Fss, M0PWM3, CAN0Tx */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_ADC) | PORT_MODE(PIN_MODE_SSI) | PORT_MODE(PIN_MODE_M0PWM)
+          | PORT_MODE(PIN_MODE_CAN), 0U,
+          PORT_CTL(PIN_MODE_SSI, 2U) | PORT_CTL(PIN_MODE_M0PWM, 4U) | PORT_CTL(PIN_MODE_CAN, 8U) },
+        /* PB6: SSI2Rx, M0PWM0 */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_SSI) | PORT_MODE(PIN_MODE_M0PWM), 0U,
+          PORT_CTL(PIN_MODE_SSI, 2U) | PORT_CTL(PIN_MODE_M0PWM, 4U) },
+        /* PB7: SSI2Tx, M0PWM1 */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_SSI) | PORT_MODE(PIN_MODE_M0PWM), 0U,
+          PORT_CTL(PIN_MODE_SSI, 2U) | PORT_CTL(PIN_MODE_M0PWM, 4U) }
+    },
+    {   /* PORTC */
+        /* PC0..PC3: JTAG/SWD */
+        PORT_DIO_ONLY,
+        PORT_DIO_ONLY,
+        PORT_DIO_ONLY,
+        PORT_DIO_ONLY,
+        /* PC4: U4Rx, M0PWM6, IDX1 */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_UART) | PORT_MODE(PIN_MODE_M0PWM) | PORT_MODE(PIN_MODE_QEI), 0U,
+          PORT_CTL(PIN_MODE_UART, 1U) | PORT_CTL(PIN_MODE_M0PWM, 4U) | PORT_CTL(PIN_MODE_QEI, 6U) },
+        /* PC5: U4Tx, M0PWM7, PhA1 */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_UART) | PORT_MODE(PIN_MODE_M0PWM) | PORT_MODE(PIN_MODE_QEI), 0U,
+          PORT_CTL(PIN_MODE_UART, 1U) | PORT_CTL(PIN_MODE_M0PWM, 4U) | PORT_CTL(PIN_MODE_QEI, 6U) },
+        /* PC6: U3Rx, PhB1 */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_UART) | PORT_MODE(PIN_MODE_QEI), 0U,
+          PORT_CTL(PIN_MODE_UART, 1U) | PORT_CTL(PIN_MODE_QEI, 6U) },
+        /* PC7: U3Tx */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_UART), 0U, PORT_CTL(PIN_MODE_UART, 1U) }
+    },
+    {   /* PORTD */
+        /* PD0: AIN7, SSI3Clk, I2C3SCL, M0PWM6, M1PWM0 */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_ADC) | PORT_MODE(PIN_MODE_SSI) | PORT_MODE(PIN_MODE_I2C)
+          | PORT_MODE(PIN_MODE_M0PWM) | PORT_MODE(PIN_MODE_M1PWM), 0U,
+          PORT_CTL(PIN_MODE_SSI, 1U) | PORT_CTL(PIN_MODE_I2C, 3U) | PORT_CTL(PIN_MODE_M0PWM, 4U)
+          | PORT_CTL(PIN_MODE_M1PWM, 5U) },
+        /* PD1: AIN6, SSI3Fss, I2C3SDA, M0PWM7, M1PWM1 */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_ADC) | PORT_MODE(PIN_MODE_SSI) | PORT_MODE(PIN_MODE_I2C)
+          | PORT_MODE(PIN_MODE_M0PWM) | PORT_MODE(PIN_MODE_M1PWM), PORT_MODE(PIN_MODE_I2C),
+          PORT_CTL(PIN_MODE_SSI, 1U) | PORT_CTL(PIN_MODE_I2C, 3U) | PORT_CTL(PIN_MODE_M0PWM, 4U)
+          | PORT_CTL(PIN_MODE_M1PWM, 5U) },
+        /* PD2: AIN5, SSI3Rx, M0FAULT0 */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_ADC) | PORT_MODE(PIN_MODE_SSI) | PORT_MODE(PIN_MODE_M0PWM), 0U,
+          PORT_CTL(PIN_MODE_SSI, 1U) | PORT_CTL(PIN_MODE_M0PWM, 4U) },
+        /* PD3: AIN4, SSI3Tx, IDX0 */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_ADC) | PORT_MODE(PIN_MODE_SSI) | PORT_MODE(PIN_MODE_QEI), 0U,
+          PORT_CTL(PIN_MODE_SSI, 1U) | PORT_CTL(PIN_MODE_QEI, 6U) },
+        /* PD4: U6Rx */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_UART), 0U, PORT_CTL(PIN_MODE_UART, 1U) },
+        /* PD5: U6Tx */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_UART), 0U, PORT_CTL(PIN_MODE_UART, 1U) },
+        /* PD6: U2Rx, M0FAULT0, PhA0 */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_UART) | PORT_MODE(PIN_MODE_M0PWM) | PORT_MODE(PIN_MODE_QEI), 0U,
+          PORT_CTL(PIN_MODE_UART, 1U) | PORT_CTL(PIN_MODE_M0PWM, 4U) | PORT_CTL(PIN_MODE_QEI, 6U) },
+        /* PD7: U2Tx, PhB0 */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_UART) | PORT_MODE(PIN_MODE_QEI), 0U,
+          PORT_CTL(PIN_MODE_UART, 1U) | PORT_CTL(PIN_MODE_QEI, 6U) }
+    },
+    {   /* PORTE */
+        /* PE0: AIN3, U7Rx */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_ADC) | PORT_MODE(PIN_MODE_UART), 0U, PORT_CTL(PIN_MODE_UART, 1U) },
+        /* PE1: AIN2, U7Tx */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_ADC) | PORT_MODE(PIN_MODE_UART), 0U, PORT_CTL(PIN_MODE_UART, 1U) },
+        /* PE2: AIN1 */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_ADC), 0U, 0U },
+        /* PE3: AIN0 */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_ADC), 0U, 0U },
+        /* PE4: AIN9, U5Rx, I2C2SCL, M0PWM4, M1PWM2, CAN0Rx */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_ADC) | PORT_MODE(PIN_MODE_UART) | PORT_MODE(PIN_MODE_I2C)
+          | PORT_MODE(PIN_MODE_M0PWM) | PORT_MODE(PIN_MODE_M1PWM) | PORT_MODE(PIN_MODE_CAN), 0U,
+          PORT_CTL(PIN_MODE_UART, 1U) | PORT_CTL(PIN_MODE_I2C, 3U) | PORT_CTL(PIN_MODE_M0PWM, 4U)
+          | PORT_CTL(PIN_MODE_M1PWM, 5U) | PORT_CTL(PIN_MODE_CAN, 8U) },
+        /* PE5: AIN8, U5Tx, I2C2SDA, M0PWM5, M1PWM3, CAN0Tx */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_ADC) | PORT_MODE(PIN_MODE_UART) | PORT_MODE(PIN_MODE_I2C)
+          | PORT_MODE(PIN_MODE_M0PWM) | PORT_MODE(PIN_MODE_M1PWM) | PORT_MODE(PIN_MODE_CAN), PORT_MODE(PIN_MODE_I2C),
+          PORT_CTL(PIN_MODE_UART, 1U) | PORT_CTL(PIN_MODE_I2C, 3U) | PORT_CTL(PIN_MODE_M0PWM, 4U)
+          | PORT_CTL(PIN_MODE_M1PWM, 5U) | PORT_CTL(PIN_MODE_CAN, 8U) },
+        /* PE6, PE7: not bonded */
+        PORT_NOT_BONDED,
+        PORT_NOT_BONDED
+    },
+    {   /* PORTF */
+        /* PF0: U1RTS, SSI1Rx, CAN0Rx, M1PWM4, PhA0 */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_UART) | PORT_MODE(PIN_MODE_SSI) | PORT_MODE(PIN_MODE_CAN)
+          | PORT_MODE(PIN_MODE_M1PWM) | PORT_MODE(PIN_MODE_QEI), 0U,
+          PORT_CTL(PIN_MODE_UART, 1U) | PORT_CTL(PIN_MODE_SSI, 2U) | PORT_CTL(PIN_MODE_CAN, 3U)
+          | PORT_CTL(PIN_MODE_M1PWM, 5U) | PORT_CTL(PIN_MODE_QEI, 6U) },
+        /* PF1: U1CTS, SSI1Tx, M1PWM5, PhB0 */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_UART) | PORT_MODE(PIN_MODE_SSI) | PORT_MODE(PIN_MODE_M1PWM)
+          | PORT_MODE(PIN_MODE_QEI), 0U,
+          PORT_CTL(PIN_MODE_UART, 1U) | PORT_CTL(PIN_MODE_SSI, 2U) | PORT_CTL(PIN_MODE_M1PWM, 5U)
+          | PORT_CTL(PIN_MODE_QEI, 6U) },
+        /* PF2: SSI1Clk, M0FAULT0, M1PWM6 */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_SSI) | PORT_MODE(PIN_MODE_M0PWM) | PORT_MODE(PIN_MODE_M1PWM), 0U,
+          PORT_CTL(PIN_MODE_SSI, 2U) | PORT_CTL(PIN_MODE_M0PWM, 4U) | PORT_CTL(PIN_MODE_M1PWM, 5U) },
+        /* PF3: SSI1Fss, CAN0Tx, M1PWM7 */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_SSI) | PORT_MODE(PIN_MODE_CAN) | PORT_MODE(PIN_MODE_M1PWM), 0U,
+          PORT_CTL(PIN_MODE_SSI, 2U) | PORT_CTL(PIN_MODE_CAN, 3U) | PORT_CTL(PIN_MODE_M1PWM, 5U) },
+        /* PF4: M1FAULT0, IDX0 */
+        { PORT_MODE(PIN_MODE_DIO) | PORT_MODE(PIN_MODE_M1PWM) | PORT_MODE(PIN_MODE_QEI), 0U,
+          PORT_CTL(PIN_MODE_M1PWM, 5U) | PORT_CTL(PIN_MODE_QEI, 6U) },
+        /* PF5..PF7: not bonded */
+        PORT_NOT_BONDED,
+        PORT_NOT_BONDED,
+        PORT_NOT_BONDED
+    }
+};
+#endif
+
+/* Base address of every GPIO port, indexed by the bus aperture then the port number */
+#if (PORT_DEVICE_TM4C129 == STD_ON)
+/* The TM4C129 has no APB aperture: PORT_BUS_APB is rejected by Port_ValidateConfig, else mapped to AHB */
+#define PORT_AHB_BASE_ADDRESSES \
+    { \
+        (volatile uint32*)GPIO_PORTA_AHB_BASE_ADDRESS, \
+        (volatile uint32*)GPIO_PORTB_AHB_BASE_ADDRESS, \
+        (volatile uint32*)GPIO_PORTC_AHB_BASE_ADDRESS, \
+        (volatile uint32*)GPIO_PORTD_AHB_BASE_ADDRESS, \
+        (volatile uint32*)GPIO_PORTE_AHB_BASE_ADDRESS, \
+        (volatile uint32*)GPIO_PORTF_AHB_BASE_ADDRESS, \
+        (volatile uint32*)GPIO_PORTG_AHB_BASE_ADDRESS, \
+        (volatile uint32*)GPIO_PORTH_AHB_BASE_ADDRESS, \
+        (volatile uint32*)GPIO_PORTJ_AHB_BASE_ADDRESS, \
+        (volatile uint32*)GPIO_PORTK_AHB_BASE_ADDRESS, \
+        (volatile uint32*)GPIO_PORTL_AHB_BASE_ADDRESS, \
+        (volatile uint32*)GPIO_PORTM_AHB_BASE_ADDRESS, \
+        (volatile uint32*)GPIO_PORTN_AHB_BASE_ADDRESS, \
+        (volatile uint32*)GPIO_PORTP_AHB_BASE_ADDRESS, \
+        (volatile uint32*)GPIO_PORTQ_AHB_BASE_ADDRESS \
+    }
+
+static volatile uint32* const Port_BaseAddress[2][PORT_NUMBER_OF_PORTS] =
+{
+    PORT_AHB_BASE_ADDRESSES,    /* PORT_BUS_APB */
+    PORT_AHB_BASE_ADDRESSES     /* PORT_BUS_AHB */
+};
+#else
+static volatile uint32* const Port_BaseAddress[2][PORT_NUMBER_OF_PORTS] =
+{
+    {   /* PORT_BUS_APB */
+        (volatile uint32*)GPIO_PORTA_BASE_ADDRESS,
+        (volatile uint32*)GPIO_PORTB_BASE_ADDRESS,
+        (volatile uint32*)GPIO_PORTC_BASE_ADDRESS,
+        (volatile uint32*)GPIO_PORTD_BASE_ADDRESS,
+        (volatile uint32*)GPIO_PORTE_BASE_ADDRESS,
+        (volatile uint32*)GPIO_PORTF_BASE_ADDRESS
+    },
+    {   /* PORT_BUS_AHB */
+        (volatile uint32*)GPIO_PORTA_AHB_BASE_ADDRESS,
+        (volatile uint32*)GPIO_PORTB_AHB_BASE_ADDRESS,
+        (volatile uint32*)GPIO_PORTC_AHB_BASE_ADDRESS,
+        (volatile uint32*)GPIO_PORTD_AHB_BASE_ADDRESS,
+        (volatile uint32*)GPIO_PORTE_AHB_BASE_ADDRESS,
+        (volatile uint32*)GPIO_PORTF_AHB_BASE_ADDRESS
+    }
+};
+#endif
+
+/* Base address of every port on the aperture selected by the configuration */
+static volatile uint32* Port_PortBase[PORT_NUMBER_OF_PORTS];
+
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+/* Shadow of the DIR, DEN, AFSEL, AMSEL, ODR and PCTL registers of every port */
+static Port_ShadowType Port_Shadow[PORT_NUMBER_OF_PORTS];
+#endif
+
+/* Base address of the port of every configured channel, resolved by Port_Init (NULL_PTR if invalid) */
+static volatile uint32* Port_ChannelBase[PORT_CONFIGURED_CHANNELS];
+
+/* Register drift found by Port_VerifyConfiguration on every port */
+static Port_DriftStatisticsType Port_Drift[PORT_NUMBER_OF_PORTS];
+
+#if (PORT_CONFIGURED_PARALLEL_BUSES > 0U)
+/* Masked GPIODATA address and shift of every parallel bus, resolved by Port_Init (Data = NULL_PTR if invalid) */
+static Port_ParallelBusAccessType Port_ParallelBuses[PORT_CONFIGURED_PARALLEL_BUSES];
+#endif
+
+#if (PORT_INTERRUPT_API == STD_ON)
+/* NVIC interrupt number of every GPIO port */
+static const uint8 Port_InterruptNumber[PORT_NUMBER_OF_PORTS] =
+{
+    NVIC_GPIO_PORTA_IRQ,
+    NVIC_GPIO_PORTB_IRQ,
+    NVIC_GPIO_PORTC_IRQ,
+    NVIC_GPIO_PORTD_IRQ,
+    NVIC_GPIO_PORTE_IRQ,
+#if (PORT_DEVICE_TM4C129 == STD_ON)
+    NVIC_GPIO_PORTF_IRQ,
+    NVIC_GPIO_PORTG_IRQ,
+    NVIC_GPIO_PORTH_IRQ,
+    NVIC_GPIO_PORTJ_IRQ,
+    NVIC_GPIO_PORTK_IRQ,
+    NVIC_GPIO_PORTL_IRQ,
+    NVIC_GPIO_PORTM_IRQ,
+    NVIC_GPIO_PORTN_IRQ,
+    NVIC_GPIO_PORTP_IRQ,
+    NVIC_GPIO_PORTQ_IRQ
+#else
+    NVIC_GPIO_PORTF_IRQ
+#endif
+};
+
+/* Dispatch table: notification of every physical pin, indexed by the port then the pin (NULL_PTR = none) */
+static Port_PinNotificationType volatile Port_Notifications[PORT_NUMBER_OF_PORTS][PORT_PINS_PER_PORT];
+#endif
+
 /******************************************************************************
  *  FUNCTION DEFINITIONS
  ******************************************************************************/
@@ -60,6 +675,13 @@ static const Port_ConfigType* Port_ConfigPtr = NULL_PTR;
 ******************************************************************************/
 void Port_Init(const Port_ConfigType* ConfigPtr)
 {
+#if (PORT_STATISTICS_API == STD_ON) || (PORT_TRACE_API == STD_ON)
+    /* Make sure the DWT cycle counter runs before taking the first timestamp */
+    CORE_DEMCR_REG |= CORE_DEMCR_TRCENA;
+    DWT_CTRL_REG |= DWT_CTRL_CYCCNTENA;
+#endif
+    PORT_STATISTICS_START();
+
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
     /* Validate the pointer parameter */
     if (NULL_PTR == ConfigPtr)
@@ -73,136 +695,135 @@ void Port_Init(const Port_ConfigType* ConfigPtr)
     }
 #endif
 
+#if (PORT_VALIDATE_CONFIG == STD_ON)
+    /* Reject a corrupted or hand-edited configuration once, before touching any register */
+    if (Port_ValidateConfig(ConfigPtr) != E_OK)
+    {
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        PORT_INIT_SID,
+                        PORT_E_PARAM_CONFIG);
+#endif
+        return;
+    }
+#endif
+
     /* Save the pointer to the config structure globally so other functions can use it */
     Port_ConfigPtr = ConfigPtr;
 
     /* For safety, mark the driver as not initialized until we finish configuration */
     Port_Status = PORT_NOT_INITIALIZED;
 
-    /* A local variable to track which ports have been enabled */
-    uint8 portsEnabledMask = 0; /* each bit in this mask can represent a port A-F as needed */
-
-    /* Loop through each pin in the config array */
     uint8 loop_idx;
+    Port_PinType pin_id;
 
-    for (loop_idx = 0; loop_idx < PORT_CONFIGURED_CHANNELS; loop_idx++)
+    /*
+     * 1. Select the bus aperture of every port with a single GPIOHBCTL write
+     *    (TM4C123 only, the TM4C129 ports are always on AHB) and enable the
+     *    clock of all the used ports with a single RCGCGPIO write
+     */
+#if (PORT_DEVICE_TM4C129 == STD_OFF)
+    uint32 ahbMask = 0U;
+#endif
+    uint32 usedPortsMask = 0U;
+#if (PORT_CLOCK_GATING == STD_ON)
+    uint32 sleepMask = 0U;
+    uint32 deepSleepMask = 0U;
+#endif
+    for (loop_idx = 0; loop_idx < PORT_NUMBER_OF_PORTS; loop_idx++)
     {
-        /* Extract the needed config fields */
-        Port_PortType port_num  = Port_ConfigPtr->Pins[loop_idx].Port_Num;  /* 0..5 => A..F */
-        Port_PinType pin_num   = Port_ConfigPtr->Pins[loop_idx].Ch_Num;     /* 0..7 => pin index */
-        Port_PinDirectionType direction = Port_ConfigPtr->Pins[loop_idx].Direction;
-        Port_PinModeType mode           = Port_ConfigPtr->Pins[loop_idx].Mode;
-        Port_PinLevelType initVal       = Port_ConfigPtr->Pins[loop_idx].InitialValue;
-        Port_InternalResistorType resistor = Port_ConfigPtr->Pins[loop_idx].Resistor;
+        Port_BusType bus = (Port_ConfigPtr->Ports[loop_idx].Bus == PORT_BUS_AHB) ? PORT_BUS_AHB : PORT_BUS_APB;
 
-        /* We assume the 6 least significant bits in 'portsEnabledMask' map to ports 0..5 */
-        if ( (portsEnabledMask & (1 << port_num)) == 0 )
+#if (PORT_DEVICE_TM4C129 == STD_OFF)
+        if (bus == PORT_BUS_AHB)
         {
-            /* Enable clock */
-            SYSCTL_RCGCGPIO_REG |= (1U << port_num);
-            portsEnabledMask |= (uint8)(1U << port_num);
+            ahbMask |= (1U << loop_idx);
         }
-
-        /* Get the base address pointer for the correct port */
-        volatile uint32* PortGpio_Ptr = NULL_PTR;
-        switch (port_num)
-        {
-            case 0: PortGpio_Ptr = (volatile uint32*)GPIO_PORTA_BASE_ADDRESS; break;
-            case 1: PortGpio_Ptr = (volatile uint32*)GPIO_PORTB_BASE_ADDRESS; break;
-            case 2: PortGpio_Ptr = (volatile uint32*)GPIO_PORTC_BASE_ADDRESS; break;
-            case 3: PortGpio_Ptr = (volatile uint32*)GPIO_PORTD_BASE_ADDRESS; break;
-            case 4: PortGpio_Ptr = (volatile uint32*)GPIO_PORTE_BASE_ADDRESS; break;
-            case 5: PortGpio_Ptr = (volatile uint32*)GPIO_PORTF_BASE_ADDRESS; break;
-            /* If invalid port_num, you could DET_ReportError and continue or return */
-            default:
-#if (PORT_DEV_ERROR_DETECT == STD_ON)
-                Det_ReportError(PORT_MODULE_ID,
-                                PORT_INSTANCE_ID,
-                                PORT_INIT_SID,
-                                PORT_E_PARAM_PIN);
 #endif
-                continue;
-        }
-
-        /* Unlock and commit for (PD7 or PF0) */
-        if (((port_num == 3) && (pin_num == 7)) ||  /* PD7 */
-            ((port_num == 5) && (pin_num == 0)))   /* PF0 */
-        {
-            /* Unlock the GPIOCR register */
-            *(volatile uint32*)((volatile uint8*)PortGpio_Ptr + PORT_LOCK_REG_OFFSET) = 0x4C4F434B;
-            /* Commit the pin changes */
-            SET_BIT(*(volatile uint32*)((volatile uint8*)PortGpio_Ptr + PORT_COMMIT_REG_OFFSET), pin_num);
-        }
-
-
-        /* Configure Direction (Input or Output) */
-        if (direction == PORT_PIN_OUT)
-        {
-            SET_BIT(*(volatile uint32*)((volatile uint8*)PortGpio_Ptr + PORT_DIR_REG_OFFSET), pin_num);
-
-            /* Set the initial value if it's an output pin */
-            if (initVal == STD_HIGH)
-            {
-                SET_BIT(*(volatile uint32*)((volatile uint8*)PortGpio_Ptr + PORT_DATA_REG_OFFSET), pin_num);
-            }
-            else
-            {
-                CLEAR_BIT(*(volatile uint32*)((volatile uint8*)PortGpio_Ptr + PORT_DATA_REG_OFFSET), pin_num);
-            }
-        }
-        else
+        if (Port_ConfigPtr->Images[loop_idx].PinMask != 0U)
         {
-            /* direction == PORT_PIN_IN */
-            CLEAR_BIT(*(volatile uint32*)((volatile uint8*)PortGpio_Ptr + PORT_DIR_REG_OFFSET), pin_num);
-
-            /* Configure the resistor (pull-up, pull-down, or off) */
-            if (resistor == PULL_UP)
-            {
-                SET_BIT(*(volatile uint32*)((volatile uint8*)PortGpio_Ptr + PORT_PULL_UP_REG_OFFSET), pin_num);
-                CLEAR_BIT(*(volatile uint32*)((volatile uint8*)PortGpio_Ptr + PORT_PULL_DOWN_REG_OFFSET), pin_num);
-            }
-            else if (resistor == PULL_DOWN)
+            usedPortsMask |= (1U << loop_idx);
+#if (PORT_CLOCK_GATING == STD_ON)
+            if (Port_ConfigPtr->Ports[loop_idx].SleepClock == TRUE)
             {
-                SET_BIT(*(volatile uint32*)((volatile uint8*)PortGpio_Ptr + PORT_PULL_DOWN_REG_OFFSET), pin_num);
-                CLEAR_BIT(*(volatile uint32*)((volatile uint8*)PortGpio_Ptr + PORT_PULL_UP_REG_OFFSET), pin_num);
+                sleepMask |= (1U << loop_idx);
             }
-            else
+            if (Port_ConfigPtr->Ports[loop_idx].DeepSleepClock == TRUE)
             {
-                /* do nothing */
+                deepSleepMask |= (1U << loop_idx);
             }
+#endif
         }
-        switch (mode)
-        {
-        case PIN_MODE_DIO:
-            /* Clear Analog Mode Select */
-            CLEAR_BIT(*(volatile uint32*)((volatile uint8*)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET), pin_num);
-
-            /* Disable Alternate Function */
-            CLEAR_BIT(*(volatile uint32*)((volatile uint8*)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET), pin_num);
+        Port_PortBase[loop_idx] = Port_BaseAddress[bus][loop_idx];
+    }
+#if (PORT_DEVICE_TM4C129 == STD_OFF)
+    SYSCTL_GPIOHBCTL_REG = (SYSCTL_GPIOHBCTL_REG & ~((1U << PORT_NUMBER_OF_PORTS) - 1U)) | ahbMask;
+#endif
+#if (PORT_CLOCK_GATING == STD_ON)
+    /* Gate the unused ports too, and set the clocks kept in sleep and deep-sleep */
+    SYSCTL_RCGCGPIO_REG = (SYSCTL_RCGCGPIO_REG & ~((1U << PORT_NUMBER_OF_PORTS) - 1U)) | usedPortsMask;
+    SYSCTL_SCGCGPIO_REG = (SYSCTL_SCGCGPIO_REG & ~((1U << PORT_NUMBER_OF_PORTS) - 1U)) | sleepMask;
+    SYSCTL_DCGCGPIO_REG = (SYSCTL_DCGCGPIO_REG & ~((1U << PORT_NUMBER_OF_PORTS) - 1U)) | deepSleepMask;
+#else
+    SYSCTL_RCGCGPIO_REG |= usedPortsMask;
+#endif
 
-            /* Clear the PCTL nibble for this pin (4 bits per pin) */
-            *(volatile uint32*)((volatile uint8*)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0F << (pin_num * 4));
+    /* 2. Resolve the base address of each pin and parallel bus in the config array */
+    for (pin_id = 0; pin_id < PORT_CONFIGURED_CHANNELS; pin_id++)
+    {
+        Port_PortType port_num = PORT_CHANNEL_PORT_NUM(Port_ConfigPtr->Pins[pin_id]);  /* 0 => PORTA, 1 => PORTB, ... */
 
-            /* Enable Digital I/O */
-            SET_BIT(*(volatile uint32*)((volatile uint8*)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET), pin_num);
-            break;
-        default:
-            /* can do many cases for other modes like (ADC, UART, etc.)*/
+        if (port_num >= PORT_NUMBER_OF_PORTS)
+        {
+            /* The runtime APIs refuse to touch a channel without a base address */
+            Port_ChannelBase[pin_id] = NULL_PTR;
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
-            /* Det error: mode not supported or not found */
             Det_ReportError(PORT_MODULE_ID,
                             PORT_INSTANCE_ID,
                             PORT_INIT_SID,
-                            PORT_E_PARAM_INVALID_MODE);
+                            PORT_E_PARAM_PIN);
+#endif
+            continue;
+        }
+
+        /* Resolve the base address once so the runtime APIs do a single indexed load */
+        Port_ChannelBase[pin_id] = Port_PortBase[port_num];
+#if (PORT_TRACE_API == STD_ON)
+        Port_TraceModes[pin_id] = PORT_CHANNEL_MODE(Port_ConfigPtr->Pins[pin_id]);
 #endif
+    }
+#if (PORT_CONFIGURED_PARALLEL_BUSES > 0U)
+    Port_ResolveParallelBuses(Port_ConfigPtr, PORT_INIT_SID);
+#endif
+
+    /* 3. Wait once until all the clocked ports are ready to be accessed */
+    while ((SYSCTL_PRGPIO_REG & usedPortsMask) != usedPortsMask)
+    {
+        /* Do nothing */
+    }
 
-            break;
+    /* 4. Apply the generated register image of every used port, each register being written once */
+    for (loop_idx = 0; loop_idx < PORT_NUMBER_OF_PORTS; loop_idx++)
+    {
+        if ((usedPortsMask & (1U << loop_idx)) == 0U)
+        {
+            /* No pin of this port is configured */
+            continue;
         }
 
+        Port_CommitImage(loop_idx, &Port_ConfigPtr->Images[loop_idx]);
     }
 
+#if (PORT_INTERRUPT_API == STD_ON)
+    /* 5. Enable the interrupt of the ports with interrupt pins, now that their triggers are set */
+    Port_EnableInterruptLines(Port_ConfigPtr);
+#endif
+
     /* Announcing that the Port driver has been initialized */
     Port_Status = PORT_INITIALIZED;
+
+    PORT_STATISTICS_STOP(PORT_INIT_SID);
 }
 
 /******************************************************************************
@@ -220,34 +841,27 @@ void Port_Init(const Port_ConfigType* ConfigPtr)
  ******************************************************************************/
 void Port_setPinDirection(Port_PinType Pin, Port_PinDirectionType Direction)
 {
+    PORT_STATISTICS_START();
+
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
     /* 1. Check if the Port Driver is initialized */
     if (Port_Status == PORT_NOT_INITIALIZED)
     {
-        Det_ReportError(PORT_MODULE_ID,
-                        PORT_INSTANCE_ID,
-                        PORT_SET_PIN_DIRECTION_SID,
-                        PORT_E_UNINIT);
+        PORT_RUNTIME_ERROR(PORT_SET_PIN_DIRECTION_SID, PORT_E_UNINIT);
         return;
     }
 
     /* 2. Check if the Pin ID is within the valid range */
     if (Pin >= PORT_CONFIGURED_CHANNELS)
     {
-        Det_ReportError(PORT_MODULE_ID,
-                        PORT_INSTANCE_ID,
-                        PORT_SET_PIN_DIRECTION_SID,
-                        PORT_E_PARAM_PIN);
+        PORT_RUNTIME_ERROR(PORT_SET_PIN_DIRECTION_SID, PORT_E_PARAM_PIN);
         return;
     }
 
     /* 3. Check if this pins direction can actually be changed at runtime */
-    if (Port_ConfigPtr->Pins[Pin].Direction_Changeable == FALSE)
+    if (PORT_CHANNEL_DIRECTION_CHANGEABLE(Port_ConfigPtr->Pins[Pin]) == FALSE)
     {
-        Det_ReportError(PORT_MODULE_ID,
-                        PORT_INSTANCE_ID,
-                        PORT_SET_PIN_DIRECTION_SID,
-                        PORT_E_DIRECTION_UNCHANGEABLE);
+        PORT_RUNTIME_ERROR(PORT_SET_PIN_DIRECTION_SID, PORT_E_DIRECTION_UNCHANGEABLE);
         return;
     }
 #endif
@@ -257,53 +871,47 @@ void Port_setPinDirection(Port_PinType Pin, Port_PinDirectionType Direction)
      * and the pin's direction is allowed to change.
      */
 
-    /* 4. Extract the port number and pin number from the configuration */
-    uint8 port_num = Port_ConfigPtr->Pins[Pin].Port_Num;  /* Which port (0..5) */
-    uint8 pin_num  = Port_ConfigPtr->Pins[Pin].Ch_Num;    /* Which pin (0..7)  */
-
-    /* 5. Get the base address of the required port */
-    volatile uint32* PortGpio_Ptr = NULL_PTR;
-    switch (port_num)
-    {
-        case 0: PortGpio_Ptr = (volatile uint32*)GPIO_PORTA_BASE_ADDRESS; break;
-        case 1: PortGpio_Ptr = (volatile uint32*)GPIO_PORTB_BASE_ADDRESS; break;
-        case 2: PortGpio_Ptr = (volatile uint32*)GPIO_PORTC_BASE_ADDRESS; break;
-        case 3: PortGpio_Ptr = (volatile uint32*)GPIO_PORTD_BASE_ADDRESS; break;
-        case 4: PortGpio_Ptr = (volatile uint32*)GPIO_PORTE_BASE_ADDRESS; break;
-        case 5: PortGpio_Ptr = (volatile uint32*)GPIO_PORTF_BASE_ADDRESS; break;
-        default:
-            /* Should never happen if we validated Pin correctly, but just in case: */
+    /* 4. Extract the pin number from the configuration */
+    uint8 pin_num  = PORT_CHANNEL_CH_NUM(Port_ConfigPtr->Pins[Pin]);    /* Which pin (0..7)  */
+
+    /* 5. Get the base address of the required port, resolved by Port_Init */
+    volatile uint32* PortGpio_Ptr = Port_ChannelBase[Pin];
+#if (PORT_VALIDATE_CONFIG == STD_OFF)
+    if (NULL_PTR == PortGpio_Ptr)
+    {
+        /* Should never happen if we validated Pin correctly, but just in case: */
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
-            Det_ReportError(PORT_MODULE_ID,
-                            PORT_INSTANCE_ID,
-                            PORT_SET_PIN_DIRECTION_SID,
-                            PORT_E_PARAM_PIN);
+        PORT_RUNTIME_ERROR(PORT_SET_PIN_DIRECTION_SID, PORT_E_PARAM_PIN);
 #endif
-            return;
+        return;
     }
+#endif
 
-    /* 6. Unlock/Commit if needed (e.g., for PD7 or PF0). */
-    if (((port_num == 3) && (pin_num == 7)) ||  /* PD7 */
-        ((port_num == 5) && (pin_num == 0)))   /* PF0 */
-    {
-        /* Unlock the GPIOCR register */
-        *(volatile uint32*)((volatile uint8*)PortGpio_Ptr + PORT_LOCK_REG_OFFSET) = 0x4C4F434B;
-        SET_BIT(*(volatile uint32*)((volatile uint8*)PortGpio_Ptr + PORT_COMMIT_REG_OFFSET), pin_num);
-    }
-    /* port C0-C3 (JTAG) Do nothing */
+    /*
+     * 6. PD7 / PF0 were committed once by Port_Init and GPIOCR keeps them
+     * writable until reset. Port C0-C3 (JTAG) are never configured.
+     */
 
-    /* 7. Actually set or clear the DIR bit */
-    if (Direction == PORT_PIN_OUT)
-    {
-        /* Set as output */
-        SET_BIT(*(volatile uint32*)((volatile uint8*)PortGpio_Ptr + PORT_DIR_REG_OFFSET), pin_num);
-    }
-    else
-    {
-        /* Set as input */
-        CLEAR_BIT(*(volatile uint32*)((volatile uint8*)PortGpio_Ptr + PORT_DIR_REG_OFFSET), pin_num);
-    }
+    PORT_TRACE(PORT_SET_PIN_DIRECTION_SID, Pin, PORT_BITBAND_REG(PortGpio_Ptr, PORT_DIR_REG_OFFSET, pin_num), Direction);
+
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+    /*
+     * 7. Actually set or clear the DIR bit: the DIR shadow and a single DIR
+     * store are updated in one PRIMASK section, so a preempting ISR changing
+     * the same port never writes a stale shadow or loses its own bit
+     */
+    uint8 pinBit = (uint8)(1U << pin_num);
+    PORT_REG_MODIFY(PortGpio_Ptr, PORT_DIR_REG_OFFSET, Port_Shadow[PORT_CHANNEL_PORT_NUM(Port_ConfigPtr->Pins[Pin])].Dir,
+                    pinBit, (Direction == PORT_PIN_OUT) ? pinBit : 0U);
+#else
+    /*
+     * 7. Actually set or clear the DIR bit: a single store to its bit-band
+     * alias, so a preempting ISR updating another pin of the port is never lost
+     */
+    PORT_BITBAND_REG(PortGpio_Ptr, PORT_DIR_REG_OFFSET, pin_num) = (Direction == PORT_PIN_OUT) ? 1U : 0U;
+#endif
 
+    PORT_STATISTICS_STOP(PORT_SET_PIN_DIRECTION_SID);
 }
 
 /******************************************************************************
@@ -319,71 +927,57 @@ void Port_setPinDirection(Port_PinType Pin, Port_PinDirectionType Direction)
 ******************************************************************************/
 void Port_RefreshPortDirection(void)
 {
+    PORT_STATISTICS_START();
+
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
     /*  Check if the Port Driver is initialized */
     if (Port_Status == PORT_NOT_INITIALIZED)
     {
-        Det_ReportError(PORT_MODULE_ID,
-                        PORT_INSTANCE_ID,
-                        PORT_REFRESH_PIN_DIRECTION_SID,
-                        PORT_E_UNINIT);
+        PORT_RUNTIME_ERROR(PORT_REFRESH_PIN_DIRECTION_SID, PORT_E_UNINIT);
         return;
     }
 #endif
 
-     uint8 loop_idx;
-    /* Loop through all configured channels */
-    for (loop_idx = 0; loop_idx < PORT_CONFIGURED_CHANNELS; loop_idx++)
+    uint8 loop_idx;
+    /* Loop through the ports, using the unchangeable pins of their register image */
+    for (loop_idx = 0; loop_idx < PORT_NUMBER_OF_PORTS; loop_idx++)
     {
-        /* Check if direction is unchangeable */
-        if (Port_ConfigPtr->Pins[loop_idx].Direction_Changeable == FALSE)
+        const Port_PortImageType* Image = &Port_ConfigPtr->Images[loop_idx];
+        uint8 fixedMask = Image->FixedDirMask;
+
+        if (fixedMask == 0U)
         {
-            /* Re-apply the originally configured direction */
-            uint8 port_num = Port_ConfigPtr->Pins[loop_idx].Port_Num;
-            uint8 pin_num  = Port_ConfigPtr->Pins[loop_idx].Ch_Num;
-            Port_PinDirectionType configuredDirection = Port_ConfigPtr->Pins[loop_idx].Direction;
+            /* No unchangeable pin on this port */
+            continue;
+        }
 
-            /* Get the base address of the required port */
-            volatile uint32* PortGpio_Ptr = NULL_PTR;
-            switch (port_num)
-            {
-                case 0: PortGpio_Ptr = (volatile uint32*)GPIO_PORTA_BASE_ADDRESS; break;
-                case 1: PortGpio_Ptr = (volatile uint32*)GPIO_PORTB_BASE_ADDRESS; break;
-                case 2: PortGpio_Ptr = (volatile uint32*)GPIO_PORTC_BASE_ADDRESS; break;
-                case 3: PortGpio_Ptr = (volatile uint32*)GPIO_PORTD_BASE_ADDRESS; break;
-                case 4: PortGpio_Ptr = (volatile uint32*)GPIO_PORTE_BASE_ADDRESS; break;
-                case 5: PortGpio_Ptr = (volatile uint32*)GPIO_PORTF_BASE_ADDRESS; break;
-                default:
-                    /* In case of invalid config, just skip or report error */
-#if (PORT_DEV_ERROR_DETECT == STD_ON)
-                    Det_ReportError(PORT_MODULE_ID,
-                                    PORT_INSTANCE_ID,
-                                    PORT_REFRESH_PIN_DIRECTION_SID,
-                                    PORT_E_PARAM_PIN);
-#endif
-                    continue; /* Move to next channel */
-            }
+        volatile uint32* PortGpio_Ptr = Port_PortBase[loop_idx];
+        uint32 dir = PORT_REG(PortGpio_Ptr, PORT_DIR_REG_OFFSET);
 
-            /* If the pin is PD7 or PF0, unlock if needed to change direction bits */
-            if (((port_num == 3) && (pin_num == 7)) ||  /* PD7 */
-                ((port_num == 5) && (pin_num == 0)))   /* PF0 */
-            {
-                *(volatile uint32*)((volatile uint8*)PortGpio_Ptr + PORT_LOCK_REG_OFFSET) = 0x4C4F434B;
-                SET_BIT(*(volatile uint32*)((volatile uint8*)PortGpio_Ptr + PORT_COMMIT_REG_OFFSET), pin_num);
-            }
-            /* If port C0-C3 (JTAG), typically do nothing to avoid issues */
+        /* Re-apply the configured direction only if it has drifted */
+        if ((dir & fixedMask) != (Image->Dir & fixedMask))
+        {
+            /* PD7 / PF0 are already committed by Port_Init, port C0-C3 (JTAG) are never configured */
+            PORT_REG_UPDATE(PortGpio_Ptr, PORT_DIR_REG_OFFSET, fixedMask, Image->Dir & fixedMask);
 
-            /* Re-apply direction */
-            if (configuredDirection == PORT_PIN_OUT)
-            {
-                SET_BIT(*(volatile uint32*)((volatile uint8*)PortGpio_Ptr + PORT_DIR_REG_OFFSET), pin_num);
-            }
-            else /* PORT_PIN_IN */
+#if (PORT_TRACE_API == STD_ON)
+            /* One record per repaired pin (repairs are rare, the loop only runs then) */
+            uint8 drifted = (uint8)((dir ^ Image->Dir) & fixedMask);
+            uint8 pin_num;
+            for (pin_num = 0; pin_num < PORT_PINS_PER_PORT; pin_num++)
             {
-                CLEAR_BIT(*(volatile uint32*)((volatile uint8*)PortGpio_Ptr + PORT_DIR_REG_OFFSET), pin_num);
+                if ((drifted & (1U << pin_num)) != 0U)
+                {
+                    PORT_TRACE(PORT_REFRESH_PIN_DIRECTION_SID,
+                               (Port_PinType)(Port_ConfigPtr->PinIds[loop_idx][pin_num] - 1U),
+                               (dir >> pin_num) & 1U, (Image->Dir >> pin_num) & 1U);
+                }
             }
+#endif
         }
     }
+
+    PORT_STATISTICS_STOP(PORT_REFRESH_PIN_DIRECTION_SID);
 }
 
 /******************************************************************************
@@ -398,6 +992,8 @@ void Port_RefreshPortDirection(void)
 ******************************************************************************/
 void Port_GetVersionInfo(Std_VersionInfoType* versioninfo)
 {
+    PORT_STATISTICS_START();
+
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
     /* Check for NULL pointer */
     if (versioninfo == NULL_PTR)
@@ -416,6 +1012,8 @@ void Port_GetVersionInfo(Std_VersionInfoType* versioninfo)
     versioninfo->sw_major_version = (uint8)PORT_SW_MAJOR_VERSION;
     versioninfo->sw_minor_version = (uint8)PORT_SW_MINOR_VERSION;
     versioninfo->sw_patch_version = (uint8)PORT_SW_PATCH_VERSION;
+
+    PORT_STATISTICS_STOP(PORT_GET_VERSION_INFO_SID);
 }
 
 /******************************************************************************
@@ -432,102 +1030,2098 @@ void Port_GetVersionInfo(Std_VersionInfoType* versioninfo)
 ******************************************************************************/
 void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode)
 {
+    PORT_STATISTICS_START();
+
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
     /* Check if the Port Driver is initialized */
     if (Port_Status == PORT_NOT_INITIALIZED)
     {
-        Det_ReportError(PORT_MODULE_ID,
-                        PORT_INSTANCE_ID,
-                        PORT_SET_PIN_MODE_SID,
-                        PORT_E_UNINIT);
+        PORT_RUNTIME_ERROR(PORT_SET_PIN_MODE_SID, PORT_E_UNINIT);
         return;
     }
 
     /* Check if Pin is within valid range */
     if (Pin >= PORT_CONFIGURED_CHANNELS)
     {
-        Det_ReportError(PORT_MODULE_ID,
-                        PORT_INSTANCE_ID,
-                        PORT_SET_PIN_MODE_SID,
-                        PORT_E_PARAM_PIN);
+        PORT_RUNTIME_ERROR(PORT_SET_PIN_MODE_SID, PORT_E_PARAM_PIN);
         return;
     }
 
     /*  Check if this pins mode is changeable at runtime */
-    if (Port_ConfigPtr->Pins[Pin].Mode_Changeable == FALSE)
+    if (PORT_CHANNEL_MODE_CHANGEABLE(Port_ConfigPtr->Pins[Pin]) == FALSE)
     {
-        Det_ReportError(PORT_MODULE_ID,
-                        PORT_INSTANCE_ID,
-                        PORT_SET_PIN_MODE_SID,
-                        PORT_E_MODE_UNCHANGEABLE);
+        PORT_RUNTIME_ERROR(PORT_SET_PIN_MODE_SID, PORT_E_MODE_UNCHANGEABLE);
         return;
     }
 
 #endif
 
     /* 4. Retrieve the Port and Pin from the config */
-    uint8 port_num = Port_ConfigPtr->Pins[Pin].Port_Num;
-    uint8 pin_num  = Port_ConfigPtr->Pins[Pin].Ch_Num;
-
-    /* 5. Get the base address for the port */
-    volatile uint32* PortGpio_Ptr = NULL_PTR;
-    switch (port_num)
-    {
-        case 0: PortGpio_Ptr = (volatile uint32*)GPIO_PORTA_BASE_ADDRESS; break;
-        case 1: PortGpio_Ptr = (volatile uint32*)GPIO_PORTB_BASE_ADDRESS; break;
-        case 2: PortGpio_Ptr = (volatile uint32*)GPIO_PORTC_BASE_ADDRESS; break;
-        case 3: PortGpio_Ptr = (volatile uint32*)GPIO_PORTD_BASE_ADDRESS; break;
-        case 4: PortGpio_Ptr = (volatile uint32*)GPIO_PORTE_BASE_ADDRESS; break;
-        case 5: PortGpio_Ptr = (volatile uint32*)GPIO_PORTF_BASE_ADDRESS; break;
-        default:
-            /* Shouldn't happen if config is valid */
+    uint8 port_num = PORT_CHANNEL_PORT_NUM(Port_ConfigPtr->Pins[Pin]);
+    uint8 pin_num  = PORT_CHANNEL_CH_NUM(Port_ConfigPtr->Pins[Pin]);
+
+    /* 5. Get the base address for the port, resolved by Port_Init */
+    volatile uint32* PortGpio_Ptr = Port_ChannelBase[Pin];
+#if (PORT_VALIDATE_CONFIG == STD_OFF)
+    if (NULL_PTR == PortGpio_Ptr)
+    {
+        /* Shouldn't happen if config is valid */
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
-            Det_ReportError(PORT_MODULE_ID,
-                            PORT_INSTANCE_ID,
-                            PORT_SET_PIN_MODE_SID,
-                            PORT_E_PARAM_PIN);
+        PORT_RUNTIME_ERROR(PORT_SET_PIN_MODE_SID, PORT_E_PARAM_PIN);
 #endif
-            return;
+        return;
     }
+#endif
 
-    /* 6. Unlock the pin (PD7 / PF0) */
-    if (((port_num == 3) && (pin_num == 7)) ||  /* PD7 */
-        ((port_num == 5) && (pin_num == 0)))   /* PF0 */
+    /* 6. PD7 / PF0 were committed once by Port_Init, no unlock is needed here */
+
+    /* 7. Configure the new mode */
+    if (Port_ApplyMode(PortGpio_Ptr, port_num, (uint8)(1U << pin_num), Mode) != E_OK)
     {
-        *(volatile uint32*)((volatile uint8*)PortGpio_Ptr + PORT_LOCK_REG_OFFSET) = 0x4C4F434B;
-        SET_BIT(*(volatile uint32*)((volatile uint8*)PortGpio_Ptr + PORT_COMMIT_REG_OFFSET), pin_num);
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+        /* Det error: mode not supported or not found */
+        PORT_RUNTIME_ERROR(PORT_SET_PIN_MODE_SID, PORT_E_PARAM_INVALID_MODE);
+#endif
+        return;
     }
 
+#if (PORT_TRACE_API == STD_ON)
+    PORT_TRACE(PORT_SET_PIN_MODE_SID, Pin, Port_TraceModes[Pin], Mode);
+    Port_TraceModes[Pin] = Mode;
+#endif
 
-    switch (Mode)
-    {
-        case PIN_MODE_DIO:
-            /* 1) Disable analog function */
-            CLEAR_BIT(*(volatile uint32*)((volatile uint8*)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET), pin_num);
+    PORT_STATISTICS_STOP(PORT_SET_PIN_MODE_SID);
+}
 
-            /* 2) Disable alternate function */
-            CLEAR_BIT(*(volatile uint32*)((volatile uint8*)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET), pin_num);
+/******************************************************************************
+* @Service Name: Port_SetPinGroupDirection
+* @Service ID[hex]: 0x05
+* @Sync/Async: Synchronous
+* @Reentrancy: Non Reentrant
+* @Parameters (in): Port - Port number (0 => PORTA, 1 => PORTB, ...)
+*                   PinMask - Pins of the port to be changed (bit n => pin n)
+*                   Direction - Port Pin direction
+* @Parameters (inout): None
+* @Parameters (out): None
+* @Return value: None
+* @Description: Non-AUTOSAR service setting the direction of several pins of
+*               one port with a single validation and a single DIR write
+******************************************************************************/
+void Port_SetPinGroupDirection(Port_PortType Port, uint8 PinMask, Port_PinDirectionType Direction)
+{
+    PORT_STATISTICS_START();
 
-            /* 3) Clear PCTL for this pin (4 bits per pin) */
-            *(volatile uint32*)((volatile uint8*)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0F << (pin_num * 4));
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Port Driver is initialized */
+    if (Port_Status == PORT_NOT_INITIALIZED)
+    {
+        PORT_RUNTIME_ERROR(PORT_SET_PIN_GROUP_DIRECTION_SID, PORT_E_UNINIT);
+        return;
+    }
 
-            /* 4) Enable digital function */
-            SET_BIT(*(volatile uint32*)((volatile uint8*)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET), pin_num);
-            break;
+    /* Check if the port exists and all the pins are configured */
+    if ((Port >= PORT_NUMBER_OF_PORTS) || (PinMask == 0U)
+     || ((PinMask & (uint8)~Port_ConfigPtr->Images[Port].PinMask) != 0U))
+    {
+        PORT_RUNTIME_ERROR(PORT_SET_PIN_GROUP_DIRECTION_SID, PORT_E_PARAM_PIN);
+        return;
+    }
 
-        default:
+    /* Check if the direction of all the pins can be changed at runtime */
+    if ((PinMask & Port_ConfigPtr->Images[Port].FixedDirMask) != 0U)
+    {
+        PORT_RUNTIME_ERROR(PORT_SET_PIN_GROUP_DIRECTION_SID, PORT_E_DIRECTION_UNCHANGEABLE);
+        return;
+    }
+#endif
 
-            /* can do many cases for other modes like (ADC, UART, etc.)*/
+    volatile uint32* PortGpio_Ptr = Port_PortBase[Port];
 
-#if (PORT_DEV_ERROR_DETECT == STD_ON)
-            /* Det error: mode not supported or not found */
-            Det_ReportError(PORT_MODULE_ID,
-                            PORT_INSTANCE_ID,
-                            PORT_SET_PIN_MODE_SID,
-                            PORT_E_PARAM_INVALID_MODE);
+#if (PORT_TRACE_API == STD_ON)
+    /*
+     * One record per pin of the group, with the direction it had. Only
+     * configured pins have a channel: without the DET checks PinMask may name
+     * others, whose PinIds entry is 0.
+     */
+    uint8 tracedPins = PinMask & Port_ConfigPtr->Images[Port].PinMask;
+    uint8 oldDir = (uint8)PORT_REG(PortGpio_Ptr, PORT_DIR_REG_OFFSET);
+    uint8 pin_num;
+    for (pin_num = 0; pin_num < PORT_PINS_PER_PORT; pin_num++)
+    {
+        if ((tracedPins & (1U << pin_num)) != 0U)
+        {
+            PORT_TRACE(PORT_SET_PIN_GROUP_DIRECTION_SID, Port_ConfigPtr->PinIds[Port][pin_num] - 1U,
+                       (oldDir >> pin_num) & 1U, Direction);
+        }
+    }
+#endif
+
+    /* Set or clear all the DIR bits at once */
+    PORT_REG_MODIFY(PortGpio_Ptr, PORT_DIR_REG_OFFSET, Port_Shadow[Port].Dir, PinMask,
+                    (Direction == PORT_PIN_OUT) ? PinMask : 0U);
+
+    PORT_STATISTICS_STOP(PORT_SET_PIN_GROUP_DIRECTION_SID);
+}
+
+/******************************************************************************
+* @Service Name: Port_SetPinGroupMode
+* @Service ID[hex]: 0x06
+* @Sync/Async: Synchronous
+* @Reentrancy: Non Reentrant
+* @Parameters (in): Port - Port number (0 => PORTA, 1 => PORTB, ...)
+*                   PinMask - Pins of the port to be changed (bit n => pin n)
+*                   Mode - New Port Pin mode to be set on these pins
+* @Parameters (inout): None
+* @Parameters (out): None
+* @Return value: None
+* @Description: Non-AUTOSAR service setting the mode of several pins of one
+*               port with a single validation and one write per register
+******************************************************************************/
+void Port_SetPinGroupMode(Port_PortType Port, uint8 PinMask, Port_PinModeType Mode)
+{
+    PORT_STATISTICS_START();
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Port Driver is initialized */
+    if (Port_Status == PORT_NOT_INITIALIZED)
+    {
+        PORT_RUNTIME_ERROR(PORT_SET_PIN_GROUP_MODE_SID, PORT_E_UNINIT);
+        return;
+    }
+
+    /* Check if the port exists and all the pins are configured */
+    if ((Port >= PORT_NUMBER_OF_PORTS) || (PinMask == 0U)
+     || ((PinMask & (uint8)~Port_ConfigPtr->Images[Port].PinMask) != 0U))
+    {
+        PORT_RUNTIME_ERROR(PORT_SET_PIN_GROUP_MODE_SID, PORT_E_PARAM_PIN);
+        return;
+    }
+
+    /* Check if the mode of all the pins can be changed at runtime */
+    if ((PinMask & Port_ConfigPtr->Images[Port].FixedModeMask) != 0U)
+    {
+        PORT_RUNTIME_ERROR(PORT_SET_PIN_GROUP_MODE_SID, PORT_E_MODE_UNCHANGEABLE);
+        return;
+    }
+#endif
+
+    volatile uint32* PortGpio_Ptr = Port_PortBase[Port];
+
+    if (Port_ApplyMode(PortGpio_Ptr, Port, PinMask, Mode) != E_OK)
+    {
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+        /* Det error: mode not supported or not found */
+        PORT_RUNTIME_ERROR(PORT_SET_PIN_GROUP_MODE_SID, PORT_E_PARAM_INVALID_MODE);
+#endif
+        return;
+    }
+
+#if (PORT_TRACE_API == STD_ON)
+    /*
+     * One record per pin of the group, and the mode of each pin kept for its
+     * next record. Only configured pins have a channel: without the DET checks
+     * PinMask may name others, whose PinIds entry is 0.
+     */
+    uint8 tracedPins = PinMask & Port_ConfigPtr->Images[Port].PinMask;
+    uint8 pin_num;
+    for (pin_num = 0; pin_num < PORT_PINS_PER_PORT; pin_num++)
+    {
+        if ((tracedPins & (1U << pin_num)) != 0U)
+        {
+            Port_PinType pin_id = Port_ConfigPtr->PinIds[Port][pin_num] - 1U;
+
+            PORT_TRACE(PORT_SET_PIN_GROUP_MODE_SID, pin_id, Port_TraceModes[pin_id], Mode);
+            Port_TraceModes[pin_id] = Mode;
+        }
+    }
+#endif
+
+    PORT_STATISTICS_STOP(PORT_SET_PIN_GROUP_MODE_SID);
+}
+
+/******************************************************************************
+* @Service Name: Port_GetPortBaseAddress
+* @Sync/Async: Synchronous
+* @Reentrancy: Reentrant
+* @Parameters (in): PortNum - Port number (0 => PORTA, 1 => PORTB, ...)
+* @Parameters (inout): None
+* @Parameters (out): None
+* @Return value: Base address of the port on the aperture selected by the
+*                configuration, NULL_PTR if the port is invalid or the driver
+*                is not initialized
+* @Description: Non-AUTOSAR service giving the Dio driver the same base
+*               addresses as the Port driver (APB or AHB)
+******************************************************************************/
+volatile uint32* Port_GetPortBaseAddress(Port_PortType PortNum)
+{
+    if ((Port_Status == PORT_NOT_INITIALIZED) || (PortNum >= PORT_NUMBER_OF_PORTS))
+    {
+        return NULL_PTR;
+    }
+
+    return Port_PortBase[PortNum];
+}
+
+/******************************************************************************
+* @Service Name: Port_GetPinId
+* @Service ID[hex]: 0x0C
+* @Sync/Async: Synchronous
+* @Reentrancy: Reentrant
+* @Parameters (in): PortNum - Port number (0 => PORTA, 1 => PORTB, ...)
+*                   ChannelNum - Pin of the port (0..7)
+* @Parameters (inout): None
+* @Parameters (out): None
+* @Return value: ID of the configured channel driving the pin (the Pin
+*                parameter of the other services), PORT_PIN_NOT_CONFIGURED if
+*                no channel drives it or the driver is not initialized
+* @Description: Non-AUTOSAR service mapping a physical pin to its channel in
+*               constant time through the generated PinIds table
+******************************************************************************/
+Port_PinType Port_GetPinId(Port_PortType PortNum, uint8 ChannelNum)
+{
+    if ((Port_Status == PORT_NOT_INITIALIZED) || (PortNum >= PORT_NUMBER_OF_PORTS) ||
+        (ChannelNum >= PORT_PINS_PER_PORT))
+    {
+        return PORT_PIN_NOT_CONFIGURED;
+    }
+
+    /* Entries hold the ID + 1 so the zero-filled ones read back as PORT_PIN_NOT_CONFIGURED */
+    return (Port_PinType)(Port_ConfigPtr->PinIds[PortNum][ChannelNum] - 1U);
+}
+
+#if (PORT_CONFIGURED_PARALLEL_BUSES > 0U)
+/******************************************************************************
+* @Service Name: Port_GetParallelBus
+* @Sync/Async: Synchronous
+* @Reentrancy: Reentrant
+* @Parameters (in): Bus - Index of the bus in the ParallelBuses array
+* @Parameters (inout): None
+* @Parameters (out): None
+* @Return value: Masked GPIODATA address and shift of the bus, NULL_PTR if
+*                the bus is invalid or the driver is not initialized
+* @Description: Non-AUTOSAR service giving the Dio driver and the application
+*               the bus resolved by Port_Init, so the whole bus is written or
+*               read with a single store or load (PORT_PARALLEL_BUS_WRITE,
+*               PORT_PARALLEL_BUS_READ). The entry is updated in place by
+*               Port_SwitchConfiguration, so the pointer can be kept.
+******************************************************************************/
+const Port_ParallelBusAccessType* Port_GetParallelBus(Port_ParallelBusType Bus)
+{
+    if ((Port_Status == PORT_NOT_INITIALIZED) || (Bus >= PORT_CONFIGURED_PARALLEL_BUSES) ||
+        (Port_ParallelBuses[Bus].Data == NULL_PTR))
+    {
+        return NULL_PTR;
+    }
+
+    return &Port_ParallelBuses[Bus];
+}
+#endif
+
+/******************************************************************************
+* @Service Name: Port_GetSnapshot
+* @Service ID[hex]: 0x0E
+* @Sync/Async: Synchronous
+* @Reentrancy: Reentrant
+* @Parameters (in): None
+* @Parameters (inout): None
+* @Parameters (out): Snapshot - DIR, DEN, AFSEL, AMSEL, PCTL, PUR, PDR and
+*                               DATA of every configured port
+* @Return value: E_OK if the snapshot was taken, E_NOT_OK otherwise
+* @Description: Non-AUTOSAR service reading back the state of all the
+*               configured ports in one pass. The registers of one port are
+*               read with the interrupts masked, so each port entry is
+*               consistent; the critical section lasts 8 register reads.
+******************************************************************************/
+Std_ReturnType Port_GetSnapshot(Port_SnapshotType* Snapshot)
+{
+    PORT_STATISTICS_START();
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (Port_Status == PORT_NOT_INITIALIZED)
+    {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        PORT_GET_SNAPSHOT_SID,
+                        PORT_E_UNINIT);
+        return E_NOT_OK;
+    }
+
+    /* Check for NULL pointer */
+    if (Snapshot == NULL_PTR)
+    {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        PORT_GET_SNAPSHOT_SID,
+                        PORT_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+#endif
+
+    const Port_PortSnapshotType unusedPort = {0U};
+    uint8 loop_idx;
+
+    Snapshot->PortMask = 0U;
+    for (loop_idx = 0; loop_idx < PORT_NUMBER_OF_PORTS; loop_idx++)
+    {
+        Port_PortSnapshotType* Entry = &Snapshot->Ports[loop_idx];
+        volatile uint32* PortGpio_Ptr = Port_PortBase[loop_idx];
+        uint32 primask;
+
+        if (Port_ConfigPtr->Images[loop_idx].PinMask == 0U)
+        {
+            /* Unused ports may not be clocked: reading them would fault */
+            *Entry = unusedPort;
+            continue;
+        }
+
+        PORT_ENTER_CRITICAL(primask);
+        Entry->Ctl = PORT_REG(PortGpio_Ptr, PORT_CTL_REG_OFFSET);
+        Entry->Dir = (uint8)PORT_REG(PortGpio_Ptr, PORT_DIR_REG_OFFSET);
+        Entry->DigitalEnable = (uint8)PORT_REG(PortGpio_Ptr, PORT_DIGITAL_ENABLE_REG_OFFSET);
+        Entry->AltFunc = (uint8)PORT_REG(PortGpio_Ptr, PORT_ALT_FUNC_REG_OFFSET);
+        Entry->AnalogMode = (uint8)PORT_REG(PortGpio_Ptr, PORT_ANALOG_MODE_SEL_REG_OFFSET);
+        Entry->PullUp = (uint8)PORT_REG(PortGpio_Ptr, PORT_PULL_UP_REG_OFFSET);
+        Entry->PullDown = (uint8)PORT_REG(PortGpio_Ptr, PORT_PULL_DOWN_REG_OFFSET);
+        Entry->Data = (uint8)PORT_REG(PortGpio_Ptr, PORT_DATA_REG_OFFSET);
+        PORT_EXIT_CRITICAL(primask);
+
+        Snapshot->PortMask |= (1U << loop_idx);
+    }
+
+    PORT_STATISTICS_STOP(PORT_GET_SNAPSHOT_SID);
+    return E_OK;
+}
+
+/******************************************************************************
+* @Service Name: Port_SaveContext
+* @Service ID[hex]: 0x0F
+* @Sync/Async: Synchronous
+* @Reentrancy: Non Reentrant
+* @Parameters (in): None
+* @Parameters (inout): None
+* @Parameters (out): Context - Registers of every configured port
+* @Return value: E_OK if the context was saved, E_NOT_OK otherwise
+* @Description: Non-AUTOSAR service saving the current register state of the
+*               configured ports before entering deep-sleep, runtime direction
+*               and mode changes included. The registers of one port are read
+*               with the interrupts masked.
+******************************************************************************/
+Std_ReturnType Port_SaveContext(Port_ContextType* Context)
+{
+    PORT_STATISTICS_START();
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (Port_Status == PORT_NOT_INITIALIZED)
+    {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        PORT_SAVE_CONTEXT_SID,
+                        PORT_E_UNINIT);
+        return E_NOT_OK;
+    }
+
+    /* Check for NULL pointer */
+    if (Context == NULL_PTR)
+    {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        PORT_SAVE_CONTEXT_SID,
+                        PORT_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+#endif
+
+    uint8 loop_idx;
+
+    Context->PortMask = 0U;
+    Context->AhbMask = 0U;
+    for (loop_idx = 0; loop_idx < PORT_NUMBER_OF_PORTS; loop_idx++)
+    {
+        Port_PortContextType* Entry = &Context->Ports[loop_idx];
+        volatile uint32* PortGpio_Ptr = Port_PortBase[loop_idx];
+        uint32 primask;
+
+        if (Port_ConfigPtr->Images[loop_idx].PinMask == 0U)
+        {
+            /* Port not owned by the driver, left to its user */
+            continue;
+        }
+
+        PORT_ENTER_CRITICAL(primask);
+        Entry->Ctl = PORT_REG(PortGpio_Ptr, PORT_CTL_REG_OFFSET);
+        Entry->Data = (uint8)PORT_REG(PortGpio_Ptr, PORT_DATA_REG_OFFSET);
+        Entry->Dir = (uint8)PORT_REG(PortGpio_Ptr, PORT_DIR_REG_OFFSET);
+        Entry->PullUp = (uint8)PORT_REG(PortGpio_Ptr, PORT_PULL_UP_REG_OFFSET);
+        Entry->PullDown = (uint8)PORT_REG(PortGpio_Ptr, PORT_PULL_DOWN_REG_OFFSET);
+        Entry->Drive2 = (uint8)PORT_REG(PortGpio_Ptr, PORT_DRIVE_2MA_REG_OFFSET);
+        Entry->Drive4 = (uint8)PORT_REG(PortGpio_Ptr, PORT_DRIVE_4MA_REG_OFFSET);
+        Entry->Drive8 = (uint8)PORT_REG(PortGpio_Ptr, PORT_DRIVE_8MA_REG_OFFSET);
+        Entry->SlewRate = (uint8)PORT_REG(PortGpio_Ptr, PORT_SLEW_RATE_REG_OFFSET);
+        Entry->OpenDrain = (uint8)PORT_REG(PortGpio_Ptr, PORT_OPEN_DRAIN_REG_OFFSET);
+        Entry->DigitalEnable = (uint8)PORT_REG(PortGpio_Ptr, PORT_DIGITAL_ENABLE_REG_OFFSET);
+        Entry->AltFunc = (uint8)PORT_REG(PortGpio_Ptr, PORT_ALT_FUNC_REG_OFFSET);
+        Entry->AnalogMode = (uint8)PORT_REG(PortGpio_Ptr, PORT_ANALOG_MODE_SEL_REG_OFFSET);
+        Entry->InterruptSense = (uint8)PORT_REG(PortGpio_Ptr, PORT_INT_SENSE_REG_OFFSET);
+        Entry->InterruptBothEdges = (uint8)PORT_REG(PortGpio_Ptr, PORT_INT_BOTH_EDGES_REG_OFFSET);
+        Entry->InterruptEvent = (uint8)PORT_REG(PortGpio_Ptr, PORT_INT_EVENT_REG_OFFSET);
+        Entry->InterruptMask = (uint8)PORT_REG(PortGpio_Ptr, PORT_INT_MASK_REG_OFFSET);
+        PORT_EXIT_CRITICAL(primask);
+
+        Context->PortMask |= (1U << loop_idx);
+        if (Port_ConfigPtr->Ports[loop_idx].Bus == PORT_BUS_AHB)
+        {
+            Context->AhbMask |= (1U << loop_idx);
+        }
+    }
+
+    PORT_STATISTICS_STOP(PORT_SAVE_CONTEXT_SID);
+    return E_OK;
+}
+
+/******************************************************************************
+* @Service Name: Port_RestoreContext
+* @Service ID[hex]: 0x10
+* @Sync/Async: Synchronous
+* @Reentrancy: Non Reentrant
+* @Parameters (in): Context - Context saved by Port_SaveContext
+* @Parameters (inout): None
+* @Parameters (out): None
+* @Return value: E_OK if the context was restored, E_NOT_OK otherwise
+* @Description: Non-AUTOSAR service restoring the ports after deep-sleep
+*               instead of calling Port_Init again: the clocks and apertures
+*               are set with one write each, then every saved register is
+*               written back as is, without reading it or walking the channel
+*               table. The cost per port is fixed, whatever the number of
+*               configured pins. Must run before the ports are used again.
+******************************************************************************/
+Std_ReturnType Port_RestoreContext(const Port_ContextType* Context)
+{
+    PORT_STATISTICS_START();
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (Port_Status == PORT_NOT_INITIALIZED)
+    {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        PORT_RESTORE_CONTEXT_SID,
+                        PORT_E_UNINIT);
+        return E_NOT_OK;
+    }
+
+    /* Check for NULL pointer */
+    if (Context == NULL_PTR)
+    {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        PORT_RESTORE_CONTEXT_SID,
+                        PORT_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+#endif
+
+    uint32 portMask = Context->PortMask & ((1U << PORT_NUMBER_OF_PORTS) - 1U);
+    uint8 loop_idx;
+
+    /* 1. Apertures and clocks of the saved ports, then a single wait for all of them */
+#if (PORT_DEVICE_TM4C129 == STD_OFF)
+    SYSCTL_GPIOHBCTL_REG = (SYSCTL_GPIOHBCTL_REG & ~portMask) | (Context->AhbMask & portMask);
+#endif
+    SYSCTL_RCGCGPIO_REG |= portMask;
+    while ((SYSCTL_PRGPIO_REG & portMask) != portMask)
+    {
+        /* Do nothing */
+    }
+
+    /* 2. Straight-line write of every register, in the order used by Port_CommitImage */
+    for (loop_idx = 0; loop_idx < PORT_NUMBER_OF_PORTS; loop_idx++)
+    {
+        const Port_PortContextType* Entry = &Context->Ports[loop_idx];
+        volatile uint32* PortGpio_Ptr = Port_PortBase[loop_idx];
+
+        if ((portMask & (1U << loop_idx)) == 0U)
+        {
+            continue;
+        }
+
+        if (Port_ConfigPtr->Images[loop_idx].CommitMask != 0U)
+        {
+            PORT_REG(PortGpio_Ptr, PORT_LOCK_REG_OFFSET) = PORT_GPIO_UNLOCK_KEY;
+            PORT_REG(PortGpio_Ptr, PORT_COMMIT_REG_OFFSET) |= Port_ConfigPtr->Images[loop_idx].CommitMask;
+        }
+
+        /* Levels before directions so the outputs do not glitch */
+        PORT_REG(PortGpio_Ptr, PORT_DATA_REG_OFFSET) = Entry->Data;
+        PORT_REG(PortGpio_Ptr, PORT_DIR_REG_OFFSET) = Entry->Dir;
+        PORT_REG(PortGpio_Ptr, PORT_PULL_UP_REG_OFFSET) = Entry->PullUp;
+        PORT_REG(PortGpio_Ptr, PORT_PULL_DOWN_REG_OFFSET) = Entry->PullDown;
+        PORT_REG(PortGpio_Ptr, PORT_DRIVE_2MA_REG_OFFSET) = Entry->Drive2;
+        PORT_REG(PortGpio_Ptr, PORT_DRIVE_4MA_REG_OFFSET) = Entry->Drive4;
+        PORT_REG(PortGpio_Ptr, PORT_DRIVE_8MA_REG_OFFSET) = Entry->Drive8;
+        PORT_REG(PortGpio_Ptr, PORT_SLEW_RATE_REG_OFFSET) = Entry->SlewRate;
+        PORT_REG(PortGpio_Ptr, PORT_ANALOG_MODE_SEL_REG_OFFSET) = Entry->AnalogMode;
+        PORT_REG(PortGpio_Ptr, PORT_ALT_FUNC_REG_OFFSET) = Entry->AltFunc;
+        PORT_REG(PortGpio_Ptr, PORT_CTL_REG_OFFSET) = Entry->Ctl;
+        PORT_REG(PortGpio_Ptr, PORT_OPEN_DRAIN_REG_OFFSET) = Entry->OpenDrain;
+        PORT_REG(PortGpio_Ptr, PORT_DIGITAL_ENABLE_REG_OFFSET) = Entry->DigitalEnable;
+
+        /* Interrupt triggers with the pins masked, then the interrupts latched meanwhile are cleared */
+        PORT_REG(PortGpio_Ptr, PORT_INT_MASK_REG_OFFSET) = 0U;
+        PORT_REG(PortGpio_Ptr, PORT_INT_SENSE_REG_OFFSET) = Entry->InterruptSense;
+        PORT_REG(PortGpio_Ptr, PORT_INT_BOTH_EDGES_REG_OFFSET) = Entry->InterruptBothEdges;
+        PORT_REG(PortGpio_Ptr, PORT_INT_EVENT_REG_OFFSET) = Entry->InterruptEvent;
+        PORT_REG(PortGpio_Ptr, PORT_INT_CLEAR_REG_OFFSET) = 0xFFU;
+        PORT_REG(PortGpio_Ptr, PORT_INT_MASK_REG_OFFSET) = Entry->InterruptMask;
+
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+        /* The shadows follow the restored registers */
+        Port_Shadow[loop_idx].Dir = Entry->Dir;
+        Port_Shadow[loop_idx].DigitalEnable = Entry->DigitalEnable;
+        Port_Shadow[loop_idx].AltFunc = Entry->AltFunc;
+        Port_Shadow[loop_idx].AnalogMode = Entry->AnalogMode;
+        Port_Shadow[loop_idx].OpenDrain = Entry->OpenDrain;
+        Port_Shadow[loop_idx].Ctl = Entry->Ctl;
+#endif
+    }
+
+    PORT_STATISTICS_STOP(PORT_RESTORE_CONTEXT_SID);
+    return E_OK;
+}
+
+/******************************************************************************
+* @Service Name: Port_VerifyConfiguration
+* @Service ID[hex]: 0x13
+* @Sync/Async: Synchronous
+* @Reentrancy: Non Reentrant
+* @Parameters (in): None
+* @Parameters (inout): None
+* @Parameters (out): None
+* @Return value: E_OK if every register matched, E_NOT_OK if drifted bits
+*                were repaired (or the driver is not initialized)
+* @Description: Non-AUTOSAR service for a periodic safety check. Every
+*               register owned by the configuration is compared with its
+*               expected value with one XOR, and only the mismatched bits are
+*               rewritten. Direction, mode, pull, drive, slew rate and
+*               interrupt registers are covered. Pins whose direction or mode
+*               is changeable are checked against the shadow registers when
+*               PORT_SHADOW_REGISTERS is enabled, and are skipped otherwise.
+*               Must be called from the priority level of the runtime changes.
+******************************************************************************/
+Std_ReturnType Port_VerifyConfiguration(void)
+{
+    PORT_STATISTICS_START();
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (Port_Status == PORT_NOT_INITIALIZED)
+    {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        PORT_VERIFY_CONFIGURATION_SID,
+                        PORT_E_UNINIT);
+        return E_NOT_OK;
+    }
+#endif
+
+    Std_ReturnType result = E_OK;
+    uint8 loop_idx;
+
+    for (loop_idx = 0; loop_idx < PORT_NUMBER_OF_PORTS; loop_idx++)
+    {
+        const Port_PortImageType* Image = &Port_ConfigPtr->Images[loop_idx];
+        volatile uint32* PortGpio_Ptr = Port_PortBase[loop_idx];
+        uint32 drifted = 0U;
+
+        if (Image->PinMask == 0U)
+        {
+            /* Port not owned by the driver */
+            continue;
+        }
+
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+        /* All the configured pins, against the last values written */
+        const Port_ShadowType* Shadow = &Port_Shadow[loop_idx];
+
+        drifted |= Port_VerifyRegister(PortGpio_Ptr, PORT_DIR_REG_OFFSET, Image->PinMask, Shadow->Dir, PORT_DRIFT_DIR);
+        drifted |= Port_VerifyRegister(PortGpio_Ptr, PORT_ANALOG_MODE_SEL_REG_OFFSET, Image->ModeMask, Shadow->AnalogMode, PORT_DRIFT_ANALOG_MODE);
+        drifted |= Port_VerifyRegister(PortGpio_Ptr, PORT_ALT_FUNC_REG_OFFSET, Image->ModeMask, Shadow->AltFunc, PORT_DRIFT_ALT_FUNC);
+        drifted |= Port_VerifyRegister(PortGpio_Ptr, PORT_CTL_REG_OFFSET, Image->CtlMask, Shadow->Ctl, PORT_DRIFT_CTL);
+        drifted |= Port_VerifyRegister(PortGpio_Ptr, PORT_OPEN_DRAIN_REG_OFFSET, Image->ModeMask, Shadow->OpenDrain, PORT_DRIFT_OPEN_DRAIN);
+        drifted |= Port_VerifyRegister(PortGpio_Ptr, PORT_DIGITAL_ENABLE_REG_OFFSET, Image->ModeMask, Shadow->DigitalEnable, PORT_DRIFT_DIGITAL_ENABLE);
+#else
+        /* Only the pins that cannot change at runtime, against the configuration */
+        uint8 fixedMode = Image->FixedModeMask & Image->ModeMask;
+
+        drifted |= Port_VerifyRegister(PortGpio_Ptr, PORT_DIR_REG_OFFSET, Image->FixedDirMask, Image->Dir, PORT_DRIFT_DIR);
+        drifted |= Port_VerifyRegister(PortGpio_Ptr, PORT_ANALOG_MODE_SEL_REG_OFFSET, fixedMode, Image->AnalogMode, PORT_DRIFT_ANALOG_MODE);
+        drifted |= Port_VerifyRegister(PortGpio_Ptr, PORT_ALT_FUNC_REG_OFFSET, fixedMode, Image->AltFunc, PORT_DRIFT_ALT_FUNC);
+        drifted |= Port_VerifyRegister(PortGpio_Ptr, PORT_CTL_REG_OFFSET, Port_CtlMask(fixedMode), Image->Ctl, PORT_DRIFT_CTL);
+        drifted |= Port_VerifyRegister(PortGpio_Ptr, PORT_OPEN_DRAIN_REG_OFFSET, fixedMode, Image->OpenDrain, PORT_DRIFT_OPEN_DRAIN);
+        drifted |= Port_VerifyRegister(PortGpio_Ptr, PORT_DIGITAL_ENABLE_REG_OFFSET, fixedMode, Image->DigitalEnable, PORT_DRIFT_DIGITAL_ENABLE);
+#endif
+
+        /* Attributes that never change at runtime */
+        drifted |= Port_VerifyRegister(PortGpio_Ptr, PORT_PULL_UP_REG_OFFSET, Image->ResistorMask, Image->PullUp, PORT_DRIFT_PULL_UP);
+        drifted |= Port_VerifyRegister(PortGpio_Ptr, PORT_PULL_DOWN_REG_OFFSET, Image->ResistorMask, Image->PullDown, PORT_DRIFT_PULL_DOWN);
+        /* A pin moved to another drive strength reads 0 in its own DRxR, setting it clears the others */
+        drifted |= Port_VerifyRegister(PortGpio_Ptr, PORT_DRIVE_2MA_REG_OFFSET, Image->Drive2, Image->Drive2, PORT_DRIFT_DRIVE);
+        drifted |= Port_VerifyRegister(PortGpio_Ptr, PORT_DRIVE_4MA_REG_OFFSET, Image->Drive4, Image->Drive4, PORT_DRIFT_DRIVE);
+        drifted |= Port_VerifyRegister(PortGpio_Ptr, PORT_DRIVE_8MA_REG_OFFSET, Image->Drive8, Image->Drive8, PORT_DRIFT_DRIVE);
+        drifted |= Port_VerifyRegister(PortGpio_Ptr, PORT_SLEW_RATE_REG_OFFSET, Image->PinMask, Image->SlewRate, PORT_DRIFT_SLEW_RATE);
+        drifted |= Port_VerifyRegister(PortGpio_Ptr, PORT_INT_SENSE_REG_OFFSET, Image->InterruptMask, Image->InterruptSense, PORT_DRIFT_INTERRUPT);
+        drifted |= Port_VerifyRegister(PortGpio_Ptr, PORT_INT_BOTH_EDGES_REG_OFFSET, Image->InterruptMask, Image->InterruptBothEdges, PORT_DRIFT_INTERRUPT);
+        drifted |= Port_VerifyRegister(PortGpio_Ptr, PORT_INT_EVENT_REG_OFFSET, Image->InterruptMask, Image->InterruptEvent, PORT_DRIFT_INTERRUPT);
+        drifted |= Port_VerifyRegister(PortGpio_Ptr, PORT_INT_MASK_REG_OFFSET, Image->InterruptMask, Image->InterruptMask, PORT_DRIFT_INTERRUPT);
+
+        Port_Drift[loop_idx].LastDriftedRegisters = drifted;
+        if (drifted != 0U)
+        {
+            Port_Drift[loop_idx].DriftCount++;
+            Port_Drift[loop_idx].DriftedRegisters |= drifted;
+            result = E_NOT_OK;
+        }
+    }
+
+    PORT_STATISTICS_STOP(PORT_VERIFY_CONFIGURATION_SID);
+    return result;
+}
+
+/******************************************************************************
+* @Service Name: Port_GetDriftStatistics
+* @Service ID[hex]: 0x14
+* @Sync/Async: Synchronous
+* @Reentrancy: Reentrant
+* @Parameters (in): Port - Port number (0 => PORTA, 1 => PORTB, ...)
+* @Parameters (inout): None
+* @Parameters (out): Statistics - Drift found on the port since start-up
+* @Return value: E_OK if the statistics were copied, E_NOT_OK otherwise
+* @Description: Non-AUTOSAR service returning the drift counters kept by
+*               Port_VerifyConfiguration for one port
+******************************************************************************/
+Std_ReturnType Port_GetDriftStatistics(Port_PortType Port, Port_DriftStatisticsType* Statistics)
+{
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Check for NULL pointer */
+    if (Statistics == NULL_PTR)
+    {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        PORT_GET_DRIFT_STATISTICS_SID,
+                        PORT_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+#endif
+
+    if (Port >= PORT_NUMBER_OF_PORTS)
+    {
+        return E_NOT_OK;
+    }
+
+    *Statistics = Port_Drift[Port];
+
+    return E_OK;
+}
+
+/******************************************************************************
+* @Service Name: Port_SwitchConfiguration
+* @Service ID[hex]: 0x0B
+* @Sync/Async: Synchronous
+* @Reentrancy: Non Reentrant
+* @Parameters (in): ConfigPtr - Pointer to the configuration variant to switch to
+* @Parameters (inout): None
+* @Parameters (out): None
+* @Return value: E_OK if the variant is active, E_NOT_OK otherwise
+* @Description: Non-AUTOSAR service switching from the active configuration
+*               variant to another one by writing only the register bits whose
+*               image differs between the two. Pins configured by neither, or
+*               configured identically by both, are never touched. Both
+*               variants must place every port on the same bus aperture.
+*               With PORT_SHADOW_REGISTERS the direction and mode registers
+*               are compared with their shadow instead, so a pin changed at
+*               runtime is brought back to the new variant. Without it, such
+*               a pin keeps its runtime direction or mode when both variants
+*               configure it the same way. Pins only the old variant uses keep
+*               their last configuration, and with PORT_CLOCK_GATING the
+*               clock masks are recomputed as in Port_Init: the ports the new
+*               variant drops are gated off and its sleep / deep-sleep clocks
+*               are applied.
+******************************************************************************/
+Std_ReturnType Port_SwitchConfiguration(const Port_ConfigType* ConfigPtr)
+{
+    PORT_STATISTICS_START();
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (Port_Status == PORT_NOT_INITIALIZED)
+    {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        PORT_SWITCH_CONFIGURATION_SID,
+                        PORT_E_UNINIT);
+        return E_NOT_OK;
+    }
+
+    /* Validate the pointer parameter */
+    if (NULL_PTR == ConfigPtr)
+    {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        PORT_SWITCH_CONFIGURATION_SID,
+                        PORT_E_PARAM_CONFIG);
+        return E_NOT_OK;
+    }
+#endif
+
+#if (PORT_VALIDATE_CONFIG == STD_ON)
+    if (Port_ValidateConfig(ConfigPtr) != E_OK)
+    {
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        PORT_SWITCH_CONFIGURATION_SID,
+                        PORT_E_PARAM_CONFIG);
+#endif
+        return E_NOT_OK;
+    }
+#endif
+
+    const Port_ConfigType* OldConfigPtr = Port_ConfigPtr;
+    uint32 usedPortsMask = 0U;
+    uint32 newPortsMask = 0U;
+#if (PORT_CLOCK_GATING == STD_ON)
+    uint32 sleepMask = 0U;
+    uint32 deepSleepMask = 0U;
+#endif
+    uint8 loop_idx;
+    Port_PinType pin_id;
+
+    /* 1. Find the ports used by the new variant, the bus of a port cannot change at runtime */
+    for (loop_idx = 0; loop_idx < PORT_NUMBER_OF_PORTS; loop_idx++)
+    {
+        if (ConfigPtr->Ports[loop_idx].Bus != OldConfigPtr->Ports[loop_idx].Bus)
+        {
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+            Det_ReportError(PORT_MODULE_ID,
+                            PORT_INSTANCE_ID,
+                            PORT_SWITCH_CONFIGURATION_SID,
+                            PORT_E_PARAM_CONFIG);
+#endif
+            return E_NOT_OK;
+        }
+        if (ConfigPtr->Images[loop_idx].PinMask != 0U)
+        {
+            usedPortsMask |= (1U << loop_idx);
+            if (OldConfigPtr->Images[loop_idx].PinMask == 0U)
+            {
+                newPortsMask |= (1U << loop_idx);
+            }
+#if (PORT_CLOCK_GATING == STD_ON)
+            if (ConfigPtr->Ports[loop_idx].SleepClock == TRUE)
+            {
+                sleepMask |= (1U << loop_idx);
+            }
+            if (ConfigPtr->Ports[loop_idx].DeepSleepClock == TRUE)
+            {
+                deepSleepMask |= (1U << loop_idx);
+            }
+#endif
+        }
+    }
+
+    /* 2. Clock the ports the old variant did not use */
+    if (newPortsMask != 0U)
+    {
+        SYSCTL_RCGCGPIO_REG |= newPortsMask;
+        while ((SYSCTL_PRGPIO_REG & newPortsMask) != newPortsMask)
+        {
+            /* Do nothing */
+        }
+    }
+
+    /* 3. Apply the full image on the newly used ports and only the differences on the others */
+    for (loop_idx = 0; loop_idx < PORT_NUMBER_OF_PORTS; loop_idx++)
+    {
+        if ((newPortsMask & (1U << loop_idx)) != 0U)
+        {
+            Port_CommitImage(loop_idx, &ConfigPtr->Images[loop_idx]);
+        }
+        else if ((usedPortsMask & (1U << loop_idx)) != 0U)
+        {
+            Port_SwitchImage(loop_idx, &OldConfigPtr->Images[loop_idx], &ConfigPtr->Images[loop_idx]);
+        }
+        else
+        {
+            /* Port not used by the new variant: left as it is */
+        }
+    }
+
+#if (PORT_CLOCK_GATING == STD_ON)
+    /* 4. Gate the ports the new variant does not use, and set its sleep and deep-sleep clocks */
+    SYSCTL_RCGCGPIO_REG = (SYSCTL_RCGCGPIO_REG & ~((1U << PORT_NUMBER_OF_PORTS) - 1U)) | usedPortsMask;
+    SYSCTL_SCGCGPIO_REG = (SYSCTL_SCGCGPIO_REG & ~((1U << PORT_NUMBER_OF_PORTS) - 1U)) | sleepMask;
+    SYSCTL_DCGCGPIO_REG = (SYSCTL_DCGCGPIO_REG & ~((1U << PORT_NUMBER_OF_PORTS) - 1U)) | deepSleepMask;
+#endif
+
+    /* 5. Resolve the base address of each pin and parallel bus of the new variant */
+    for (pin_id = 0; pin_id < PORT_CONFIGURED_CHANNELS; pin_id++)
+    {
+        Port_PortType port_num = PORT_CHANNEL_PORT_NUM(ConfigPtr->Pins[pin_id]);
+
+        Port_ChannelBase[pin_id] = (port_num < PORT_NUMBER_OF_PORTS) ? Port_PortBase[port_num] : NULL_PTR;
+#if (PORT_TRACE_API == STD_ON)
+        Port_TraceModes[pin_id] = PORT_CHANNEL_MODE(ConfigPtr->Pins[pin_id]);
+#endif
+    }
+#if (PORT_CONFIGURED_PARALLEL_BUSES > 0U)
+    Port_ResolveParallelBuses(ConfigPtr, PORT_SWITCH_CONFIGURATION_SID);
+#endif
+
+#if (PORT_INTERRUPT_API == STD_ON)
+    /* 6. Enable the interrupt of the ports gaining interrupt pins (the notifications stay bound to their pins) */
+    Port_EnableInterruptLines(ConfigPtr);
+#endif
+
+    Port_ConfigPtr = ConfigPtr;
+
+    PORT_STATISTICS_STOP(PORT_SWITCH_CONFIGURATION_SID);
+    return E_OK;
+}
+
+/******************************************************************************
+* @Service Name: Port_ValidateConfig
+* @Service ID[hex]: 0x0A
+* @Sync/Async: Synchronous
+* @Reentrancy: Reentrant
+* @Parameters (in): ConfigPtr - Pointer to the post-build configuration data
+* @Parameters (inout): None
+* @Parameters (out): None
+* @Return value: E_OK if the configuration is consistent, E_NOT_OK otherwise
+* @Description: Non-AUTOSAR service checking a configuration without touching
+*               the hardware: every channel on a bonded pin with a supported
+*               mode, no pin configured twice, valid buses, register images
+*               encoding exactly the channel table (direction, level,
+*               resistor, mode, PCTL, drive, open drain, slew rate and
+*               interrupt of every pin), and parallel buses made of DIO
+*               channels. Called by Port_Init when PORT_VALIDATE_CONFIG is
+*               enabled.
+******************************************************************************/
+Std_ReturnType Port_ValidateConfig(const Port_ConfigType* ConfigPtr)
+{
+    uint8 pinMasks[PORT_NUMBER_OF_PORTS] = {0U};
+    uint8 loop_idx;
+    Port_PinType pin_id;
+
+    if (ConfigPtr == NULL_PTR)
+    {
+        return E_NOT_OK;
+    }
+
+    for (pin_id = 0; pin_id < PORT_CONFIGURED_CHANNELS; pin_id++)
+    {
+        Port_PortType port_num = PORT_CHANNEL_PORT_NUM(ConfigPtr->Pins[pin_id]);
+        Port_PinType pin_num = PORT_CHANNEL_CH_NUM(ConfigPtr->Pins[pin_id]);
+        Port_PinModeType mode = PORT_CHANNEL_MODE(ConfigPtr->Pins[pin_id]);
+        Port_PinDirectionType direction = PORT_CHANNEL_DIRECTION(ConfigPtr->Pins[pin_id]);
+
+        if ((port_num >= PORT_NUMBER_OF_PORTS) || (pin_num >= 8U) || (mode >= PORT_NUMBER_OF_MODES) ||
+            ((direction != PORT_PIN_IN) && (direction != PORT_PIN_OUT)))
+        {
+            return E_NOT_OK;
+        }
+
+        if (PORT_CHANNEL_INTERRUPT(ConfigPtr->Pins[pin_id]) > PORT_PIN_INTERRUPT_HIGH_LEVEL)
+        {
+            return E_NOT_OK;
+        }
+
+        /* Slew rate control is only available with the 8 mA drive */
+        if ((PORT_CHANNEL_DRIVE(ConfigPtr->Pins[pin_id]) > PORT_PIN_DRIVE_8MA) ||
+            ((PORT_CHANNEL_SLEW_RATE(ConfigPtr->Pins[pin_id]) == TRUE) &&
+             (PORT_CHANNEL_DRIVE(ConfigPtr->Pins[pin_id]) != PORT_PIN_DRIVE_8MA)))
+        {
+            return E_NOT_OK;
+        }
+
+        /* The pin must be bonded and support its mode (a single bit test) */
+        if ((Port_PinModes[port_num][pin_num].Modes & PORT_MODE(mode)) == 0U)
+        {
+            return E_NOT_OK;
+        }
+
+        /* Port_Init programs the image as is: its bits of the pin must encode this channel */
+        if (Port_CheckPinImage(&ConfigPtr->Images[port_num], port_num, (uint8)pin_num, &ConfigPtr->Pins[pin_id]) != E_OK)
+        {
+            return E_NOT_OK;
+        }
+
+        /* Each pin may appear only once, and the reverse table must point back to it */
+        if (((pinMasks[port_num] & (1U << pin_num)) != 0U) ||
+            (ConfigPtr->PinIds[port_num][pin_num] != (Port_PinType)(pin_id + 1U)))
+        {
+            return E_NOT_OK;
+        }
+        pinMasks[port_num] |= (uint8)(1U << pin_num);
+    }
+
+    for (loop_idx = 0; loop_idx < PORT_NUMBER_OF_PORTS; loop_idx++)
+    {
+        const Port_PortImageType* Image = &ConfigPtr->Images[loop_idx];
+
+#if (PORT_DEVICE_TM4C129 == STD_ON)
+        /* The TM4C129 GPIO ports have no APB aperture */
+        if (ConfigPtr->Ports[loop_idx].Bus != PORT_BUS_AHB)
+#else
+        if ((ConfigPtr->Ports[loop_idx].Bus != PORT_BUS_APB) && (ConfigPtr->Ports[loop_idx].Bus != PORT_BUS_AHB))
+#endif
+        {
+            return E_NOT_OK;
+        }
+
+        /* No other pin of the port may be mapped to a channel */
+        uint8 pin_num;
+        for (pin_num = 0; pin_num < PORT_PINS_PER_PORT; pin_num++)
+        {
+            if (((pinMasks[loop_idx] & (1U << pin_num)) == 0U) && (ConfigPtr->PinIds[loop_idx][pin_num] != 0U))
+            {
+                return E_NOT_OK;
+            }
+        }
+
+        /* Port_Init applies the image as is: it must cover exactly the configured pins */
+        if ((Image->PinMask != pinMasks[loop_idx]) ||
+            (((Image->CommitMask | Image->Dir | Image->DataMask | Image->ResistorMask | Image->ModeMask |
+               Image->OpenDrainPins | Image->SlewRate | Image->InterruptMask) & (uint8)~Image->PinMask) != 0U) ||
+            (((Image->InterruptSense | Image->InterruptBothEdges | Image->InterruptEvent) &
+              (uint8)~Image->InterruptMask) != 0U) ||
+            ((Image->Drive2 | Image->Drive4 | Image->Drive8) != Image->PinMask) ||
+            ((Image->Drive2 & Image->Drive4) != 0U) || ((Image->Drive2 & Image->Drive8) != 0U) ||
+            ((Image->Drive4 & Image->Drive8) != 0U))
+        {
+            return E_NOT_OK;
+        }
+    }
+
+#if (PORT_CONFIGURED_PARALLEL_BUSES > 0U)
+    for (loop_idx = 0; loop_idx < PORT_CONFIGURED_PARALLEL_BUSES; loop_idx++)
+    {
+        const Port_ParallelBusConfigType* Bus = &ConfigPtr->ParallelBuses[loop_idx];
+        uint8 pin_num;
+
+        /* Configured pins of one port, Shift being the lowest of them */
+        if ((Bus->Port >= PORT_NUMBER_OF_PORTS) || (Bus->PinMask == 0U) ||
+            ((Bus->PinMask & (uint8)~pinMasks[Bus->Port]) != 0U) || (Bus->Shift >= PORT_PINS_PER_PORT) ||
+            ((Bus->PinMask & (uint8)((1U << Bus->Shift) - 1U)) != 0U) || (((Bus->PinMask >> Bus->Shift) & 1U) == 0U))
+        {
+            return E_NOT_OK;
+        }
+
+        /* A load or store of GPIODATA only reaches the pins configured as DIO */
+        for (pin_num = Bus->Shift; pin_num < PORT_PINS_PER_PORT; pin_num++)
+        {
+            if (((Bus->PinMask & (1U << pin_num)) != 0U) &&
+                (PORT_CHANNEL_MODE(ConfigPtr->Pins[ConfigPtr->PinIds[Bus->Port][pin_num] - 1U]) != PIN_MODE_DIO))
+            {
+                return E_NOT_OK;
+            }
+        }
+    }
+#endif
+
+    return E_OK;
+}
+
+#if (PORT_STATISTICS_API == STD_ON)
+/******************************************************************************
+* @Service Name: Port_GetStatistics
+* @Service ID[hex]: 0x07
+* @Sync/Async: Synchronous
+* @Reentrancy: Reentrant
+* @Parameters (in): ServiceId - Service ID of the measured API (e.g. PORT_INIT_SID)
+* @Parameters (inout): None
+* @Parameters (out): Statistics - Execution time statistics of the service
+* @Return value: E_OK if the statistics were copied, E_NOT_OK otherwise
+* @Description: Non-AUTOSAR service returning the call count and the min, max
+*               and average DWT cycle count of the completed calls of a service
+******************************************************************************/
+Std_ReturnType Port_GetStatistics(uint8 ServiceId, Port_StatisticsType* Statistics)
+{
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Check for NULL pointer */
+    if (Statistics == NULL_PTR)
+    {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        PORT_GET_STATISTICS_SID,
+                        PORT_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+#endif
+
+    if (ServiceId >= PORT_STATISTICS_SERVICES)
+    {
+        return E_NOT_OK;
+    }
+
+    const Port_CyclesType* Cycles = &Port_Cycles[ServiceId];
+
+    Statistics->Count = Cycles->Count;
+    Statistics->MinCycles = Cycles->MinCycles;
+    Statistics->MaxCycles = Cycles->MaxCycles;
+    Statistics->AverageCycles = (Cycles->Count == 0U) ? 0U : (uint32)(Cycles->TotalCycles / Cycles->Count);
+
+    return E_OK;
+}
+#endif
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON) && (PORT_DEFERRED_ERROR_REPORT == STD_ON)
+/******************************************************************************
+* @Service Name: Port_MainFunction
+* @Service ID[hex]: 0x12
+* @Sync/Async: Synchronous
+* @Reentrancy: Non Reentrant
+* @Parameters (in): None
+* @Parameters (inout): None
+* @Parameters (out): None
+* @Return value: None
+* @Description: Non-AUTOSAR service to be called from a background task.
+*               Reports to DET the errors posted by the runtime services since
+*               the previous call, at most PORT_DET_REPORTS_PER_CYCLE of them.
+*               Repeated occurrences of one error are reported once, their
+*               number stays available through Port_GetErrorCount.
+******************************************************************************/
+void Port_MainFunction(void)
+{
+    uint32 reports = 0U;
+    uint32 scanned;
+
+    for (scanned = 0U; (scanned < PORT_DEFERRED_ERRORS) && (reports < PORT_DET_REPORTS_PER_CYCLE); scanned++)
+    {
+        uint8 entry = Port_ErrorScan;
+        uint16 posted = Port_ErrorPosted[entry];
+
+        Port_ErrorScan = (uint8)((entry + 1U) % PORT_DEFERRED_ERRORS);
+        if (posted != Port_ErrorReported[entry])
+        {
+            Port_ErrorReported[entry] = posted;
+            Det_ReportError(PORT_MODULE_ID,
+                            PORT_INSTANCE_ID,
+                            (uint8)(entry / PORT_DEFERRED_ERROR_CODES),
+                            (uint8)(PORT_E_PARAM_PIN + (entry % PORT_DEFERRED_ERROR_CODES)));
+            reports++;
+        }
+    }
+}
+
+/******************************************************************************
+* @Service Name: Port_GetErrorCount
+* @Sync/Async: Synchronous
+* @Reentrancy: Reentrant
+* @Parameters (in): ServiceId - Service ID of a runtime service (e.g. PORT_SET_PIN_DIRECTION_SID)
+*                   ErrorId - DET error code (e.g. PORT_E_PARAM_PIN)
+* @Parameters (inout): None
+* @Parameters (out): None
+* @Return value: Number of times the service posted the error (modulo 2^16),
+*                0 for a service or error without deferred reporting
+* @Description: Non-AUTOSAR service returning the occurrence counter of a
+*               deferred error, including the occurrences not reported to DET
+******************************************************************************/
+uint16 Port_GetErrorCount(uint8 ServiceId, uint8 ErrorId)
+{
+    if ((ServiceId >= PORT_DEFERRED_SERVICES) || (ErrorId < PORT_E_PARAM_PIN) || (ErrorId > PORT_E_PARAM_POINTER))
+    {
+        return 0U;
+    }
+
+    return Port_ErrorPosted[((uint32)ServiceId * PORT_DEFERRED_ERROR_CODES) + ((uint32)ErrorId - PORT_E_PARAM_PIN)];
+}
+#endif
+
+#if (PORT_TRACE_API == STD_ON)
+/******************************************************************************
+* @Service Name: Port_ReadTrace
+* @Service ID[hex]: 0x11
+* @Sync/Async: Synchronous
+* @Reentrancy: Non Reentrant
+* @Parameters (in): None
+* @Parameters (inout): None
+* @Parameters (out): Record - Oldest pin configuration change not read yet
+* @Return value: E_OK if a record was read, E_NOT_OK if the buffer is empty
+* @Description: Non-AUTOSAR service draining the trace ring buffer from a
+*               background task. It only advances the tail index, so the
+*               traced services can preempt it at any point and interrupts are
+*               never disabled.
+******************************************************************************/
+Std_ReturnType Port_ReadTrace(Port_TraceRecordType* Record)
+{
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Check for NULL pointer */
+    if (Record == NULL_PTR)
+    {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        PORT_READ_TRACE_SID,
+                        PORT_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+#endif
+
+    uint32 tail = Port_TraceTail;
+
+    if (tail == Port_TraceHead)
+    {
+        return E_NOT_OK;
+    }
+
+    const volatile Port_TraceRecordType* Entry = &Port_TraceBuffer[tail & (PORT_TRACE_BUFFER_SIZE - 1U)];
+
+    Record->Timestamp = Entry->Timestamp;
+    Record->Pin = Entry->Pin;
+    Record->ServiceId = Entry->ServiceId;
+    Record->OldValue = Entry->OldValue;
+    Record->NewValue = Entry->NewValue;
+
+    /* Release the slot only once it has been copied */
+    Port_TraceTail = tail + 1U;
+
+    return E_OK;
+}
+
+/******************************************************************************
+* @Service Name: Port_GetTraceLostCount
+* @Sync/Async: Synchronous
+* @Reentrancy: Reentrant
+* @Parameters (in): None
+* @Parameters (inout): None
+* @Parameters (out): None
+* @Return value: Number of records dropped because the trace buffer was full
+* @Description: Non-AUTOSAR service telling the background task that it does
+*               not drain the trace buffer often enough
+******************************************************************************/
+uint32 Port_GetTraceLostCount(void)
+{
+    return Port_TraceLost;
+}
+#endif
+
+#if (PORT_STREAM_API == STD_ON)
+/******************************************************************************
+* @Service Name: Port_StartStream
+* @Service ID[hex]: 0x08
+* @Sync/Async: Asynchronous
+* @Reentrancy: Reentrant for different uDMA channels
+* @Parameters (in): Stream - Pin group and uDMA channel of the stream
+*                   Buffer - Samples to output, one byte per request
+*                   Length - Number of samples (1..1024)
+* @Parameters (inout): None
+* @Parameters (out): None
+* @Return value: E_OK if the stream was started, E_NOT_OK otherwise
+* @Description: Non-AUTOSAR service writing Buffer into the GPIODATA address
+*               mask window of the pin group, one sample per request of the
+*               selected uDMA channel assignment. The pacing peripheral (e.g.
+*               a timer) is configured and started by its own driver.
+******************************************************************************/
+Std_ReturnType Port_StartStream(const Port_StreamConfigType* Stream, const uint8* Buffer, uint16 Length)
+{
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (Port_Status == PORT_NOT_INITIALIZED)
+    {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        PORT_START_STREAM_SID,
+                        PORT_E_UNINIT);
+        return E_NOT_OK;
+    }
+
+    /* Check for NULL pointers */
+    if ((Stream == NULL_PTR) || (Buffer == NULL_PTR))
+    {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        PORT_START_STREAM_SID,
+                        PORT_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    /* The streamed pins must all be configured on the port */
+    if ((Stream->Port >= PORT_NUMBER_OF_PORTS) || (Stream->PinMask == 0U) ||
+        ((Stream->PinMask & ~Port_ConfigPtr->Images[Stream->Port].PinMask) != 0U))
+    {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        PORT_START_STREAM_SID,
+                        PORT_E_PARAM_PIN);
+        return E_NOT_OK;
+    }
+#endif
+
+    uint32 channelBit = (uint32)1U << (Stream->DmaChannel & 0x1FU);
+
+    if ((Stream->DmaChannel >= PORT_DMA_CHANNELS) || (Stream->DmaEncoding >= PORT_DMA_ENCODINGS) ||
+        (Length == 0U) || (Length > PORT_DMA_MAX_TRANSFER) || ((UDMA_ENASET_REG & channelBit) != 0U))
+    {
+        /* Invalid channel or length, or the channel is still busy */
+        return E_NOT_OK;
+    }
+
+    /* Enable the controller and install the control table, unless another driver already did */
+    if ((UDMA_STAT_REG & UDMA_MASTER_ENABLE) == 0U)
+    {
+        SYSCTL_RCGCDMA_REG |= 0x01U;
+        while ((SYSCTL_PRDMA_REG & 0x01U) == 0U)
+        {
+            /* Wait for the uDMA controller to be ready */
+        }
+        UDMA_CFG_REG = UDMA_MASTER_ENABLE;
+        UDMA_CTLBASE_REG = PORT_DMA_ADDRESS(Port_DmaControlTable);
+    }
+
+    /* Route the requested channel assignment to the channel */
+    uint32 mapShift = (uint32)(Stream->DmaChannel % 8U) * 4U;
+    Port_AtomicUpdate(&UDMA_CHMAP_REG(Stream->DmaChannel / 8U), (uint32)0x0FU << mapShift,
+                      (uint32)Stream->DmaEncoding << mapShift);
+
+    /* Primary structure, default priority, single requests only */
+    UDMA_ALTCLR_REG = channelBit;
+    UDMA_PRIOCLR_REG = channelBit;
+    UDMA_USEBURSTCLR_REG = channelBit;
+
+    /* Every sample is stored through the address mask window of the pin group */
+    Port_DmaControlType* Control = &((Port_DmaControlType*)PORT_DMA_POINTER(UDMA_CTLBASE_REG))[Stream->DmaChannel];
+    Control->SrcEnd = PORT_DMA_ADDRESS(&Buffer[Length - 1U]);
+    Control->DstEnd = PORT_DMA_ADDRESS(&PORT_REG(Port_PortBase[Stream->Port], PORT_DATA_MASKED_OFFSET(Stream->PinMask)));
+    Control->Control = PORT_DMA_STREAM_CONTROL(Length);
+
+    /* Start serving the requests */
+    UDMA_REQMASKCLR_REG = channelBit;
+    UDMA_ENASET_REG = channelBit;
+
+    return E_OK;
+}
+
+/******************************************************************************
+* @Service Name: Port_StopStream
+* @Service ID[hex]: 0x09
+* @Sync/Async: Synchronous
+* @Reentrancy: Reentrant
+* @Parameters (in): Stream - Pin group and uDMA channel of the stream
+* @Parameters (inout): None
+* @Parameters (out): None
+* @Return value: None
+* @Description: Non-AUTOSAR service stopping a stream before its end, the pins
+*               keep the last sample written
+******************************************************************************/
+void Port_StopStream(const Port_StreamConfigType* Stream)
+{
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Check for NULL pointer */
+    if (Stream == NULL_PTR)
+    {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        PORT_STOP_STREAM_SID,
+                        PORT_E_PARAM_POINTER);
+        return;
+    }
+#endif
+
+    if (Stream->DmaChannel < PORT_DMA_CHANNELS)
+    {
+        UDMA_ENACLR_REG = (uint32)1U << Stream->DmaChannel;
+    }
+}
+#endif
+
+#if (PORT_INTERRUPT_API == STD_ON)
+/******************************************************************************
+* @Service Name: Port_SetPinNotification
+* @Service ID[hex]: 0x0D
+* @Sync/Async: Synchronous
+* @Reentrancy: Reentrant
+* @Parameters (in): Pin - Port Pin ID number
+*                   Notification - Function called when the interrupt of the
+*                                  pin fires, NULL_PTR to remove it
+* @Parameters (inout): None
+* @Parameters (out): None
+* @Return value: None
+* @Description: Non-AUTOSAR service registering the notification of a pin in
+*               the dispatch table of its port. The trigger itself comes from
+*               the configuration. The entry belongs to the physical pin, so it
+*               is kept across Port_SwitchConfiguration.
+******************************************************************************/
+void Port_SetPinNotification(Port_PinType Pin, Port_PinNotificationType Notification)
+{
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (Port_Status == PORT_NOT_INITIALIZED)
+    {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        PORT_SET_PIN_NOTIFICATION_SID,
+                        PORT_E_UNINIT);
+        return;
+    }
+
+    /* Check if the Pin ID is within the valid range */
+    if (Pin >= PORT_CONFIGURED_CHANNELS)
+    {
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        PORT_SET_PIN_NOTIFICATION_SID,
+                        PORT_E_PARAM_PIN);
+        return;
+    }
+#endif
+
+    Port_PortType port_num = PORT_CHANNEL_PORT_NUM(Port_ConfigPtr->Pins[Pin]);
+#if (PORT_VALIDATE_CONFIG == STD_OFF)
+    if (port_num >= PORT_NUMBER_OF_PORTS)
+    {
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        PORT_SET_PIN_NOTIFICATION_SID,
+                        PORT_E_PARAM_PIN);
+#endif
+        return;
+    }
+#endif
+
+    /* A single pointer store: the handler sees either the old or the new notification */
+    Port_Notifications[port_num][PORT_CHANNEL_CH_NUM(Port_ConfigPtr->Pins[Pin])] = Notification;
+}
+
+/******************************************************************************
+* @Service Name: Port_GpioPortA_Handler .. Port_GpioPortQ_Handler
+* @Sync/Async: Synchronous
+* @Reentrancy: Non Reentrant
+* @Parameters (in): None
+* @Parameters (inout): None
+* @Parameters (out): None
+* @Return value: None
+* @Description: Interrupt handlers of the GPIO ports, to be placed in the
+*               vector table (GPIO Port A..E are interrupts 0..4, F is 30;
+*               G..Q exist on the TM4C129 only, see NVIC_GPIO_PORTG_IRQ..)
+******************************************************************************/
+void Port_GpioPortA_Handler(void)
+{
+    Port_DispatchInterrupts(0U);
+}
+
+void Port_GpioPortB_Handler(void)
+{
+    Port_DispatchInterrupts(1U);
+}
+
+void Port_GpioPortC_Handler(void)
+{
+    Port_DispatchInterrupts(2U);
+}
+
+void Port_GpioPortD_Handler(void)
+{
+    Port_DispatchInterrupts(3U);
+}
+
+void Port_GpioPortE_Handler(void)
+{
+    Port_DispatchInterrupts(4U);
+}
+
+void Port_GpioPortF_Handler(void)
+{
+    Port_DispatchInterrupts(5U);
+}
+#if (PORT_DEVICE_TM4C129 == STD_ON)
+void Port_GpioPortG_Handler(void)
+{
+    Port_DispatchInterrupts(6U);
+}
+
+void Port_GpioPortH_Handler(void)
+{
+    Port_DispatchInterrupts(7U);
+}
+
+void Port_GpioPortJ_Handler(void)
+{
+    Port_DispatchInterrupts(8U);
+}
+
+void Port_GpioPortK_Handler(void)
+{
+    Port_DispatchInterrupts(9U);
+}
+
+void Port_GpioPortL_Handler(void)
+{
+    Port_DispatchInterrupts(10U);
+}
+
+void Port_GpioPortM_Handler(void)
+{
+    Port_DispatchInterrupts(11U);
+}
+
+void Port_GpioPortN_Handler(void)
+{
+    Port_DispatchInterrupts(12U);
+}
+
+void Port_GpioPortP_Handler(void)
+{
+    Port_DispatchInterrupts(13U);
+}
+
+void Port_GpioPortQ_Handler(void)
+{
+    Port_DispatchInterrupts(14U);
+}
+#endif
+#endif
+
+/******************************************************************************
+ *  LOCAL FUNCTION DEFINITIONS
+ ******************************************************************************/
+
+/******************************************************************************
+* @Function Name: Port_CommitImage
+* @Parameters (in): Port - Port number (0 => PORTA, 1 => PORTB, ...)
+*                   Image - Register image of the port
+* @Return value: None
+* @Description: Writes the register image of one port, touching each register
+*               once and only the bits owned by the image
+******************************************************************************/
+static void Port_CommitImage(Port_PortType Port, const Port_PortImageType* Image)
+{
+    volatile uint32* PortGpio_Ptr = Port_PortBase[Port];
+
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+    /* Seed the shadows with the current register values, read once per port */
+    Port_ShadowType* Shadow = &Port_Shadow[Port];
+
+    Shadow->Dir = (uint8)PORT_REG(PortGpio_Ptr, PORT_DIR_REG_OFFSET);
+    Shadow->DigitalEnable = (uint8)PORT_REG(PortGpio_Ptr, PORT_DIGITAL_ENABLE_REG_OFFSET);
+    Shadow->AltFunc = (uint8)PORT_REG(PortGpio_Ptr, PORT_ALT_FUNC_REG_OFFSET);
+    Shadow->AnalogMode = (uint8)PORT_REG(PortGpio_Ptr, PORT_ANALOG_MODE_SEL_REG_OFFSET);
+    Shadow->OpenDrain = (uint8)PORT_REG(PortGpio_Ptr, PORT_OPEN_DRAIN_REG_OFFSET);
+    Shadow->Ctl = PORT_REG(PortGpio_Ptr, PORT_CTL_REG_OFFSET);
+#endif
+
+    /*
+     * Unlock the GPIOCR register and commit the locked pins. GPIOCR keeps
+     * them writable until reset, so the runtime APIs never unlock again.
+     */
+    if (Image->CommitMask != 0U)
+    {
+        PORT_REG(PortGpio_Ptr, PORT_LOCK_REG_OFFSET) = PORT_GPIO_UNLOCK_KEY;
+        PORT_REG(PortGpio_Ptr, PORT_COMMIT_REG_OFFSET) |= Image->CommitMask;
+    }
+
+    /* Direction of all the configured pins */
+    PORT_REG_MODIFY(PortGpio_Ptr, PORT_DIR_REG_OFFSET, Shadow->Dir, Image->PinMask, Image->Dir);
+
+    /* Initial level of the output pins: one store through the GPIODATA address mask */
+    if (Image->DataMask != 0U)
+    {
+        PORT_REG(PortGpio_Ptr, PORT_DATA_MASKED_OFFSET(Image->DataMask)) = Image->Data;
+    }
+
+    /* Internal resistor of the input pins */
+    if (Image->ResistorMask != 0U)
+    {
+        PORT_REG_UPDATE(PortGpio_Ptr, PORT_PULL_UP_REG_OFFSET, Image->ResistorMask, Image->PullUp);
+        PORT_REG_UPDATE(PortGpio_Ptr, PORT_PULL_DOWN_REG_OFFSET, Image->ResistorMask, Image->PullDown);
+    }
+
+    /* Drive strength: setting a pin in one DRxR register clears it in the two others */
+    if (Image->Drive2 != 0U)
+    {
+        PORT_REG_UPDATE(PortGpio_Ptr, PORT_DRIVE_2MA_REG_OFFSET, Image->Drive2, Image->Drive2);
+    }
+    if (Image->Drive4 != 0U)
+    {
+        PORT_REG_UPDATE(PortGpio_Ptr, PORT_DRIVE_4MA_REG_OFFSET, Image->Drive4, Image->Drive4);
+    }
+    if (Image->Drive8 != 0U)
+    {
+        PORT_REG_UPDATE(PortGpio_Ptr, PORT_DRIVE_8MA_REG_OFFSET, Image->Drive8, Image->Drive8);
+    }
+
+    /* Slew rate control, after the 8 mA drive it depends on */
+    PORT_REG_UPDATE(PortGpio_Ptr, PORT_SLEW_RATE_REG_OFFSET, Image->PinMask, Image->SlewRate);
+
+    /* Mode of the pins */
+    if (Image->ModeMask != 0U)
+    {
+        PORT_REG_MODIFY(PortGpio_Ptr, PORT_ANALOG_MODE_SEL_REG_OFFSET, Shadow->AnalogMode, Image->ModeMask, Image->AnalogMode);
+        PORT_REG_MODIFY(PortGpio_Ptr, PORT_ALT_FUNC_REG_OFFSET, Shadow->AltFunc, Image->ModeMask, Image->AltFunc);
+        PORT_REG_MODIFY(PortGpio_Ptr, PORT_CTL_REG_OFFSET, Shadow->Ctl, Image->CtlMask, Image->Ctl);
+        PORT_REG_MODIFY(PortGpio_Ptr, PORT_OPEN_DRAIN_REG_OFFSET, Shadow->OpenDrain, Image->ModeMask, Image->OpenDrain);
+        PORT_REG_MODIFY(PortGpio_Ptr, PORT_DIGITAL_ENABLE_REG_OFFSET, Shadow->DigitalEnable, Image->ModeMask, Image->DigitalEnable);
+    }
+
+    /*
+     * Interrupt triggers, once the inputs are enabled: masked while the sense
+     * changes, then the interrupts it may have latched are cleared
+     */
+    if (Image->InterruptMask != 0U)
+    {
+        PORT_REG_UPDATE(PortGpio_Ptr, PORT_INT_MASK_REG_OFFSET, Image->InterruptMask, 0U);
+        PORT_REG_UPDATE(PortGpio_Ptr, PORT_INT_SENSE_REG_OFFSET, Image->InterruptMask, Image->InterruptSense);
+        PORT_REG_UPDATE(PortGpio_Ptr, PORT_INT_BOTH_EDGES_REG_OFFSET, Image->InterruptMask, Image->InterruptBothEdges);
+        PORT_REG_UPDATE(PortGpio_Ptr, PORT_INT_EVENT_REG_OFFSET, Image->InterruptMask, Image->InterruptEvent);
+        PORT_REG(PortGpio_Ptr, PORT_INT_CLEAR_REG_OFFSET) = Image->InterruptMask;
+        PORT_REG_UPDATE(PortGpio_Ptr, PORT_INT_MASK_REG_OFFSET, Image->InterruptMask, Image->InterruptMask);
+    }
+}
+
+/******************************************************************************
+* @Function Name: Port_SwitchImage
+* @Parameters (in): Port - Port number (0 => PORTA, 1 => PORTB, ...)
+*                   Old - Register image of the active variant
+*                   New - Register image of the variant to switch to
+* @Return value: None
+* @Description: Writes only the bits of the new image that differ from the old
+*               one (from the shadow for the shadowed registers). Output levels
+*               are set before the directions so a pin that becomes an output
+*               does not glitch to a stale level.
+******************************************************************************/
+static void Port_SwitchImage(Port_PortType Port, const Port_PortImageType* Old, const Port_PortImageType* New)
+{
+    volatile uint32* PortGpio_Ptr = Port_PortBase[Port];
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+    Port_ShadowType* Shadow = &Port_Shadow[Port];
+#endif
+    uint8 changed;
+    uint32 ctlChanged;
+
+    /* Pins of the new variant that the old one did not commit (GPIOCR keeps the old ones) */
+    changed = New->CommitMask & (uint8)~Old->CommitMask;
+    if (changed != 0U)
+    {
+        PORT_REG(PortGpio_Ptr, PORT_LOCK_REG_OFFSET) = PORT_GPIO_UNLOCK_KEY;
+        PORT_REG(PortGpio_Ptr, PORT_COMMIT_REG_OFFSET) |= changed;
+    }
+
+    changed = PORT_CHANGED_BITS(Old->DataMask, Old->Data, New->DataMask, New->Data);
+    if (changed != 0U)
+    {
+        PORT_REG(PortGpio_Ptr, PORT_DATA_MASKED_OFFSET(changed)) = New->Data;
+    }
+
+    changed = PORT_SHADOW_CHANGED_BITS(Old->PinMask, Old->Dir, Shadow->Dir, New->PinMask, New->Dir);
+    if (changed != 0U)
+    {
+        PORT_REG_MODIFY(PortGpio_Ptr, PORT_DIR_REG_OFFSET, Shadow->Dir, changed, New->Dir & changed);
+    }
+
+    changed = PORT_CHANGED_BITS(Old->ResistorMask, Old->PullUp, New->ResistorMask, New->PullUp);
+    if (changed != 0U)
+    {
+        PORT_REG_UPDATE(PortGpio_Ptr, PORT_PULL_UP_REG_OFFSET, changed, New->PullUp & changed);
+    }
+
+    changed = PORT_CHANGED_BITS(Old->ResistorMask, Old->PullDown, New->ResistorMask, New->PullDown);
+    if (changed != 0U)
+    {
+        PORT_REG_UPDATE(PortGpio_Ptr, PORT_PULL_DOWN_REG_OFFSET, changed, New->PullDown & changed);
+    }
+
+    /* Pins moving to another drive strength (a DRxR bit clears the pin in the two others) */
+    changed = New->Drive2 & (uint8)~Old->Drive2;
+    if (changed != 0U)
+    {
+        PORT_REG_UPDATE(PortGpio_Ptr, PORT_DRIVE_2MA_REG_OFFSET, changed, changed);
+    }
+    changed = New->Drive4 & (uint8)~Old->Drive4;
+    if (changed != 0U)
+    {
+        PORT_REG_UPDATE(PortGpio_Ptr, PORT_DRIVE_4MA_REG_OFFSET, changed, changed);
+    }
+    changed = New->Drive8 & (uint8)~Old->Drive8;
+    if (changed != 0U)
+    {
+        PORT_REG_UPDATE(PortGpio_Ptr, PORT_DRIVE_8MA_REG_OFFSET, changed, changed);
+    }
+
+    changed = PORT_CHANGED_BITS(Old->PinMask, Old->SlewRate, New->PinMask, New->SlewRate);
+    if (changed != 0U)
+    {
+        PORT_REG_UPDATE(PortGpio_Ptr, PORT_SLEW_RATE_REG_OFFSET, changed, New->SlewRate & changed);
+    }
+
+    changed = PORT_SHADOW_CHANGED_BITS(Old->ModeMask, Old->AnalogMode, Shadow->AnalogMode, New->ModeMask, New->AnalogMode);
+    if (changed != 0U)
+    {
+        PORT_REG_MODIFY(PortGpio_Ptr, PORT_ANALOG_MODE_SEL_REG_OFFSET, Shadow->AnalogMode, changed, New->AnalogMode & changed);
+    }
+
+    changed = PORT_SHADOW_CHANGED_BITS(Old->ModeMask, Old->AltFunc, Shadow->AltFunc, New->ModeMask, New->AltFunc);
+    if (changed != 0U)
+    {
+        PORT_REG_MODIFY(PortGpio_Ptr, PORT_ALT_FUNC_REG_OFFSET, Shadow->AltFunc, changed, New->AltFunc & changed);
+    }
+
+    ctlChanged = PORT_SHADOW_CHANGED_BITS(Old->CtlMask, Old->Ctl, Shadow->Ctl, New->CtlMask, New->Ctl);
+    if (ctlChanged != 0U)
+    {
+        PORT_REG_MODIFY(PortGpio_Ptr, PORT_CTL_REG_OFFSET, Shadow->Ctl, ctlChanged, New->Ctl & ctlChanged);
+    }
+
+    changed = PORT_SHADOW_CHANGED_BITS(Old->ModeMask, Old->OpenDrain, Shadow->OpenDrain, New->ModeMask, New->OpenDrain);
+    if (changed != 0U)
+    {
+        PORT_REG_MODIFY(PortGpio_Ptr, PORT_OPEN_DRAIN_REG_OFFSET, Shadow->OpenDrain, changed, New->OpenDrain & changed);
+    }
+
+    changed = PORT_SHADOW_CHANGED_BITS(Old->ModeMask, Old->DigitalEnable, Shadow->DigitalEnable, New->ModeMask, New->DigitalEnable);
+    if (changed != 0U)
+    {
+        PORT_REG_MODIFY(PortGpio_Ptr, PORT_DIGITAL_ENABLE_REG_OFFSET, Shadow->DigitalEnable, changed, New->DigitalEnable & changed);
+    }
+
+    /* Pins gaining, losing or changing their interrupt trigger, masked while it changes */
+    changed = (uint8)((Old->InterruptMask ^ New->InterruptMask) |
+                      (Old->InterruptMask & New->InterruptMask &
+                       ((Old->InterruptSense ^ New->InterruptSense) |
+                        (Old->InterruptBothEdges ^ New->InterruptBothEdges) |
+                        (Old->InterruptEvent ^ New->InterruptEvent))));
+    if (changed != 0U)
+    {
+        PORT_REG_UPDATE(PortGpio_Ptr, PORT_INT_MASK_REG_OFFSET, changed, 0U);
+        PORT_REG_UPDATE(PortGpio_Ptr, PORT_INT_SENSE_REG_OFFSET, changed, New->InterruptSense & changed);
+        PORT_REG_UPDATE(PortGpio_Ptr, PORT_INT_BOTH_EDGES_REG_OFFSET, changed, New->InterruptBothEdges & changed);
+        PORT_REG_UPDATE(PortGpio_Ptr, PORT_INT_EVENT_REG_OFFSET, changed, New->InterruptEvent & changed);
+        PORT_REG(PortGpio_Ptr, PORT_INT_CLEAR_REG_OFFSET) = changed;
+        PORT_REG_UPDATE(PortGpio_Ptr, PORT_INT_MASK_REG_OFFSET, changed, New->InterruptMask & changed);
+    }
+}
+
+/******************************************************************************
+* @Function Name: Port_CtlMask
+* @Parameters (in): PinMask - Pins of a port (bit n => pin n)
+* @Return value: Mask of the PCTL nibbles of these pins
+* @Description: Spreads each pin bit over its 4-bit PCTL field
+******************************************************************************/
+static uint32 Port_CtlMask(uint8 PinMask)
+{
+    /* PCTL nibbles of 4 consecutive pins */
+    static const uint16 Port_NibbleMask[16] =
+    {
+        0x0000U, 0x000FU, 0x00F0U, 0x00FFU, 0x0F00U, 0x0F0FU, 0x0FF0U, 0x0FFFU,
+        0xF000U, 0xF00FU, 0xF0F0U, 0xF0FFU, 0xFF00U, 0xFF0FU, 0xFFF0U, 0xFFFFU
+    };
+
+    return (uint32)Port_NibbleMask[PinMask & 0x0FU] | ((uint32)Port_NibbleMask[PinMask >> 4] << 16);
+}
+
+/******************************************************************************
+* @Function Name: Port_AtomicUpdate
+* @Parameters (in): Reg_Ptr - Address of the register
+*                   Mask - Bits of the register to replace
+*                   Value - New value of the Mask bits
+* @Return value: None
+* @Description: Read-modify-write of a register done with LDREX/STREX: any
+*               exception taken between the load and the store clears the
+*               exclusive monitor, so the store fails and the update is retried
+*               on the fresh value instead of overwriting the ISR's change. The
+*               cost is the same load and store as a plain read-modify-write,
+*               plus one compare and branch, and one retry per interruption.
+*               Compilers without GCC-style inline assembly for ARMv7-M use a
+*               plain read-modify-write.
+******************************************************************************/
+static void Port_AtomicUpdate(volatile uint32* Reg_Ptr, uint32 Mask, uint32 Value)
+{
+#if defined(__GNUC__) && (defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__))
+    uint32 regValue;
+    uint32 failed;
+
+    do
+    {
+        __asm volatile ("ldrex %0, [%1]" : "=r" (regValue) : "r" (Reg_Ptr) : "memory");
+        regValue = (regValue & ~Mask) | Value;
+        __asm volatile ("strex %0, %2, [%1]" : "=&r" (failed) : "r" (Reg_Ptr), "r" (regValue) : "memory");
+    } while (failed != 0U);
+#else
+    *Reg_Ptr = (*Reg_Ptr & ~Mask) | Value;
+#endif
+}
+
+/******************************************************************************
+* @Function Name: Port_CheckPinImage
+* @Parameters (in): Image - Register image of the port
+*                   Port - Port number (0 => PORTA, 1 => PORTB, ...)
+*                   PinNum - Pin of the port (0..7)
+*                   Channel - Channel configured on this pin
+* @Return value: E_OK if every image bit of the pin matches the channel,
+*                E_NOT_OK otherwise
+* @Description: Rebuilds the image bits of one pin from its channel (the
+*               direction, level, resistor, drive, interrupt and the mode
+*               tables) and compares them with the generated image
+******************************************************************************/
+static Std_ReturnType Port_CheckPinImage(const Port_PortImageType* Image, Port_PortType Port, uint8 PinNum, const Port_ConfigChannel* Channel)
+{
+    uint8 bit = (uint8)(1U << PinNum);
+    Port_PinModeType mode = PORT_CHANNEL_MODE(*Channel);
+    uint8 attributes = Port_ModeAttributes[mode];
+    const Port_PinModesType* PinModes = &Port_PinModes[Port][PinNum];
+    boolean output = (PORT_CHANNEL_DIRECTION(*Channel) == PORT_PIN_OUT) ? TRUE : FALSE;
+    Port_InternalResistorType resistor = (output == TRUE) ? RESISTOR_OFF : PORT_CHANNEL_RESISTOR(*Channel);
+    Port_PinDriveType drive = PORT_CHANNEL_DRIVE(*Channel);
+    Port_PinInterruptType trigger = PORT_CHANNEL_INTERRUPT(*Channel);
+    uint32 ctl = (mode < PORT_CTL_MODES) ? ((PinModes->Ctl >> (mode * 4U)) & 0x0FU) : 0U;
+    boolean openDrainPin = PORT_CHANNEL_OPEN_DRAIN(*Channel);
+    boolean openDrain = ((openDrainPin == TRUE) || ((PinModes->OpenDrainModes & PORT_MODE(mode)) != 0U)) ? TRUE : FALSE;
+
+    /* Every 8-bit member of the image and the expected state of its pin bit, in the same order */
+    const uint8 actual[] =
+    {
+        Image->Dir, Image->FixedDirMask, Image->FixedModeMask, Image->DataMask, Image->Data,
+        Image->ResistorMask, Image->PullUp, Image->PullDown, Image->ModeMask, Image->DigitalEnable,
+        Image->AltFunc, Image->AnalogMode, Image->OpenDrain, Image->OpenDrainPins, Image->Drive2,
+        Image->Drive4, Image->Drive8, Image->SlewRate, Image->InterruptMask, Image->InterruptSense,
+        Image->InterruptBothEdges, Image->InterruptEvent
+    };
+    const boolean expected[] =
+    {
+        output,
+        (PORT_CHANNEL_DIRECTION_CHANGEABLE(*Channel) == TRUE) ? FALSE : TRUE,
+        (PORT_CHANNEL_MODE_CHANGEABLE(*Channel) == TRUE) ? FALSE : TRUE,
+        output,
+        ((output == TRUE) && (PORT_CHANNEL_INITIAL_VALUE(*Channel) == STD_HIGH)) ? TRUE : FALSE,
+        (resistor != RESISTOR_OFF) ? TRUE : FALSE,
+        (resistor == PULL_UP) ? TRUE : FALSE,
+        (resistor == PULL_DOWN) ? TRUE : FALSE,
+        TRUE,
+        ((attributes & PORT_MODE_DEN) != 0U) ? TRUE : FALSE,
+        ((attributes & PORT_MODE_AFSEL) != 0U) ? TRUE : FALSE,
+        ((attributes & PORT_MODE_AMSEL) != 0U) ? TRUE : FALSE,
+        openDrain,
+        openDrainPin,
+        (drive == PORT_PIN_DRIVE_2MA) ? TRUE : FALSE,
+        (drive == PORT_PIN_DRIVE_4MA) ? TRUE : FALSE,
+        (drive == PORT_PIN_DRIVE_8MA) ? TRUE : FALSE,
+        PORT_CHANNEL_SLEW_RATE(*Channel),
+        (trigger != PORT_PIN_INTERRUPT_NONE) ? TRUE : FALSE,
+        ((trigger == PORT_PIN_INTERRUPT_LOW_LEVEL) || (trigger == PORT_PIN_INTERRUPT_HIGH_LEVEL)) ? TRUE : FALSE,
+        (trigger == PORT_PIN_INTERRUPT_BOTH_EDGES) ? TRUE : FALSE,
+        ((trigger == PORT_PIN_INTERRUPT_RISING_EDGE) || (trigger == PORT_PIN_INTERRUPT_HIGH_LEVEL)) ? TRUE : FALSE
+    };
+    uint8 member;
+
+    for (member = 0U; member < (uint8)(sizeof(actual) / sizeof(actual[0])); member++)
+    {
+        if (((actual[member] & bit) != 0U) != (expected[member] == TRUE))
+        {
+            return E_NOT_OK;
+        }
+    }
+
+    /* PCTL nibble of the pin, owned by the image */
+    if ((((Image->CtlMask >> (PinNum * 4U)) & 0x0FU) != 0x0FU) || (((Image->Ctl >> (PinNum * 4U)) & 0x0FU) != ctl))
+    {
+        return E_NOT_OK;
+    }
+
+    return E_OK;
+}
+
+/******************************************************************************
+* @Function Name: Port_VerifyRegister
+* @Parameters (in): PortGpio_Ptr - Base address of the port
+*                   Offset - Offset of the register
+*                   Mask - Bits of the register to be verified
+*                   Expected - Expected value of the Mask bits
+*                   Drift - PORT_DRIFT_* flag of the register
+* @Return value: Drift if some bits had drifted, 0 otherwise
+* @Description: Compares the Mask bits of a register with their expected value
+*               and rewrites only the mismatched ones
+******************************************************************************/
+static uint32 Port_VerifyRegister(volatile uint32* PortGpio_Ptr, uint32 Offset, uint32 Mask, uint32 Expected, uint32 Drift)
+{
+    uint32 mismatch = (PORT_REG(PortGpio_Ptr, Offset) ^ Expected) & Mask;
+
+    if (mismatch == 0U)
+    {
+        return 0U;
+    }
+
+    PORT_REG_UPDATE(PortGpio_Ptr, Offset, mismatch, Expected & mismatch);
+
+    return Drift;
+}
+
+/******************************************************************************
+* @Function Name: Port_ApplyMode
+* @Parameters (in): PortGpio_Ptr - Base address of the port
+*                   Port - Port number (0 => PORTA, 1 => PORTB, ...)
+*                   PinMask - Pins of the port to be changed (bit n => pin n)
+*                   Mode - New mode of these pins
+* @Return value: E_OK if the mode is supported by all the pins, E_NOT_OK
+*                otherwise (nothing is written)
+* @Description: Configures the mode of several pins of one port from the mode
+*               capability table, writing each register once
+******************************************************************************/
+static Std_ReturnType Port_ApplyMode(volatile uint32* PortGpio_Ptr, Port_PortType Port, uint8 PinMask, Port_PinModeType Mode)
+{
+    if (Mode >= PORT_NUMBER_OF_MODES)
+    {
+        return E_NOT_OK;
+    }
+
+    uint16 modeBit = (uint16)(1U << Mode);
+    uint32 ctl = 0U;
+    uint8 openDrain = 0U;
+    uint8 pin_num;
+
+    /* 1) Look up every pin: one bit test rejects an unsupported combination */
+    for (pin_num = 0; pin_num < 8U; pin_num++)
+    {
+        if ((PinMask & (1U << pin_num)) != 0U)
+        {
+            const Port_PinModesType* PinModes = &Port_PinModes[Port][pin_num];
+
+            if ((PinModes->Modes & modeBit) == 0U)
+            {
+                return E_NOT_OK;
+            }
+            if (Mode < PORT_CTL_MODES)
+            {
+                ctl |= ((PinModes->Ctl >> (Mode * 4U)) & 0x0FU) << (pin_num * 4U);
+            }
+            if ((PinModes->OpenDrainModes & modeBit) != 0U)
+            {
+                openDrain |= (uint8)(1U << pin_num);
+            }
+        }
+    }
+
+    /* Pins configured open-drain stay open-drain in every mode (drive and slew rate are kept as is) */
+    openDrain |= Port_ConfigPtr->Images[Port].OpenDrainPins & PinMask;
+
+    /* 2) Fixed write sequence, each register being written once */
+    uint8 attributes = Port_ModeAttributes[Mode];
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+    Port_ShadowType* Shadow = &Port_Shadow[Port];
+#endif
+
+    PORT_REG_MODIFY(PortGpio_Ptr, PORT_ANALOG_MODE_SEL_REG_OFFSET, Shadow->AnalogMode, PinMask,
+                    ((attributes & PORT_MODE_AMSEL) != 0U) ? PinMask : 0U);
+    PORT_REG_MODIFY(PortGpio_Ptr, PORT_ALT_FUNC_REG_OFFSET, Shadow->AltFunc, PinMask,
+                    ((attributes & PORT_MODE_AFSEL) != 0U) ? PinMask : 0U);
+    PORT_REG_MODIFY(PortGpio_Ptr, PORT_CTL_REG_OFFSET, Shadow->Ctl, Port_CtlMask(PinMask), ctl);
+    PORT_REG_MODIFY(PortGpio_Ptr, PORT_OPEN_DRAIN_REG_OFFSET, Shadow->OpenDrain, PinMask, openDrain);
+    PORT_REG_MODIFY(PortGpio_Ptr, PORT_DIGITAL_ENABLE_REG_OFFSET, Shadow->DigitalEnable, PinMask,
+                    ((attributes & PORT_MODE_DEN) != 0U) ? PinMask : 0U);
+
+    return E_OK;
+}
+
+#if (PORT_STATISTICS_API == STD_ON)
+/******************************************************************************
+* @Function Name: Port_RecordCycles
+* @Parameters (in): ServiceId - Service ID of the measured API
+*                   Cycles - DWT cycles spent in the call
+* @Return value: None
+* @Description: Accumulates the duration of one call. Concurrent calls of
+*               reentrant services may lose a sample.
+******************************************************************************/
+static void Port_RecordCycles(uint8 ServiceId, uint32 Cycles)
+{
+    Port_CyclesType* Entry = &Port_Cycles[ServiceId];
+
+    if ((Entry->Count == 0U) || (Cycles < Entry->MinCycles))
+    {
+        Entry->MinCycles = Cycles;
+    }
+    if (Cycles > Entry->MaxCycles)
+    {
+        Entry->MaxCycles = Cycles;
+    }
+    Entry->TotalCycles += Cycles;
+    Entry->Count++;
+}
+#endif
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON) && (PORT_DEFERRED_ERROR_REPORT == STD_ON)
+/******************************************************************************
+* @Function Name: Port_PostError
+* @Parameters (in): Entry - Index of the service and error code in Port_ErrorPosted
+* @Return value: None
+* @Description: Counts one deferred error. The read-modify-write of the
+*               counter runs with the interrupts masked, so the reentrant
+*               services posting from an ISR and from the task they preempt
+*               never lose an error.
+******************************************************************************/
+static void Port_PostError(uint32 Entry)
+{
+    uint32 primask;
+
+    PORT_ENTER_CRITICAL(primask);
+    Port_ErrorPosted[Entry]++;
+    PORT_EXIT_CRITICAL(primask);
+}
+#endif
+
+#if (PORT_CONFIGURED_PARALLEL_BUSES > 0U)
+/******************************************************************************
+* @Function Name: Port_ResolveParallelBuses
+* @Parameters (in): ConfigPtr - Configuration whose buses are resolved
+*                   ServiceId - Service reporting an invalid bus to DET
+* @Return value: None
+* @Description: Computes the masked GPIODATA address of every parallel bus
+*               on the aperture of its port, NULL_PTR for an invalid bus
+******************************************************************************/
+static void Port_ResolveParallelBuses(const Port_ConfigType* ConfigPtr, uint8 ServiceId)
+{
+    uint8 bus;
+
+    for (bus = 0; bus < PORT_CONFIGURED_PARALLEL_BUSES; bus++)
+    {
+        const Port_ParallelBusConfigType* Bus = &ConfigPtr->ParallelBuses[bus];
+
+        if ((Bus->Port >= PORT_NUMBER_OF_PORTS) || (Bus->PinMask == 0U))
+        {
+            Port_ParallelBuses[bus].Data = NULL_PTR;
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+            Det_ReportError(PORT_MODULE_ID,
+                            PORT_INSTANCE_ID,
+                            ServiceId,
+                            PORT_E_PARAM_CONFIG);
+#else
+            (void)ServiceId;
+#endif
+            continue;
+        }
+
+        Port_ParallelBuses[bus].Data = &PORT_REG(Port_PortBase[Bus->Port], PORT_DATA_MASKED_OFFSET(Bus->PinMask));
+        Port_ParallelBuses[bus].PinMask = Bus->PinMask;
+        Port_ParallelBuses[bus].Shift = Bus->Shift;
+    }
+}
+#endif
+
+#if (PORT_INTERRUPT_API == STD_ON)
+/******************************************************************************
+* @Function Name: Port_EnableInterruptLines
+* @Parameters (in): ConfigPtr - Pointer to the post-build configuration data
+* @Return value: None
+* @Description: Enables the NVIC line of the ports having interrupt pins, with
+*               one store per NVIC_EN register. On the TM4C129, PORTP and
+*               PORTQ are first switched to their summary interrupt.
+******************************************************************************/
+static void Port_EnableInterruptLines(const Port_ConfigType* ConfigPtr)
+{
+    uint32 lines[PORT_NVIC_EN_REGS] = {0U};
+    uint8 loop_idx;
+
+    for (loop_idx = 0; loop_idx < PORT_NUMBER_OF_PORTS; loop_idx++)
+    {
+        uint8 irq = Port_InterruptNumber[loop_idx];
+
+        if (ConfigPtr->Images[loop_idx].InterruptMask != 0U)
+        {
+#if (PORT_DEVICE_TM4C129 == STD_ON)
+            if ((PORT_SUMMARY_INTERRUPT_PORTS & (1U << loop_idx)) != 0U)
+            {
+                PORT_REG(Port_PortBase[loop_idx], PORT_SELECT_INTERRUPT_REG_OFFSET) = PORT_SELECT_INTERRUPT_SUM;
+            }
+#endif
+            lines[irq >> 5U] |= (1U << (irq & 0x1FU));
+        }
+    }
+
+    for (loop_idx = 0; loop_idx < PORT_NVIC_EN_REGS; loop_idx++)
+    {
+        NVIC_EN_REG(loop_idx) = lines[loop_idx];
+    }
+}
+
+/******************************************************************************
+* @Function Name: Port_DispatchInterrupts
+* @Parameters (in): Port - Port number (0 => PORTA, 1 => PORTB, ...)
+* @Return value: None
+* @Description: Reads the masked interrupt status of the port once and calls
+*               the notification of every pending pin, the highest pin first.
+*               Each pending pin is found with a count-leading-zeros instead of
+*               testing the 8 bits, so the latency does not depend on the pin.
+*               The status is acknowledged before the notifications run, so an
+*               edge arriving meanwhile raises the interrupt again.
+******************************************************************************/
+static void Port_DispatchInterrupts(Port_PortType Port)
+{
+    volatile uint32* PortGpio_Ptr = Port_PortBase[Port];
+    uint32 status = PORT_REG(PortGpio_Ptr, PORT_INT_MASKED_STATUS_REG_OFFSET);
+
+    PORT_REG(PortGpio_Ptr, PORT_INT_CLEAR_REG_OFFSET) = status;
+
+    while (status != 0U)
+    {
+        uint32 pin_num = PORT_HIGHEST_PIN(status);
+        Port_PinNotificationType Notification = Port_Notifications[Port][pin_num];
+
+        status &= ~(1U << pin_num);
+        if (Notification != NULL_PTR)
+        {
+            Notification();
+        }
+    }
+}
+
+#if !defined(__GNUC__)
+/******************************************************************************
+* @Function Name: Port_HighestPin
+* @Parameters (in): Status - Non-zero interrupt status of a port
+* @Return value: Number of the highest pin set in Status
+* @Description: Portable replacement of the CLZ instruction for 8 pins
+******************************************************************************/
+static uint32 Port_HighestPin(uint32 Status)
+{
+    /* Highest bit set in a nibble */
+    static const uint8 Port_HighestBit[16] =
+    {
+        0U, 0U, 1U, 1U, 2U, 2U, 2U, 2U, 3U, 3U, 3U, 3U, 3U, 3U, 3U, 3U
+    };
+
+    return (Status > 0x0FU) ? (4U + Port_HighestBit[(Status >> 4) & 0x0FU]) : Port_HighestBit[Status];
+}
 #endif
-            /* Do nothing, or revert to default, or return */
-            return;
+#endif
+
+#if (PORT_TRACE_API == STD_ON)
+/******************************************************************************
+* @Function Name: Port_TraceEvent
+* @Parameters (in): ServiceId - Service making the change
+*                   Pin - Pin ID of the changed channel
+*                   OldValue - Direction or mode before the change
+*                   NewValue - Direction or mode after the change
+* @Return value: None
+* @Description: Appends one record to the trace ring buffer, or counts it as
+*               lost if the buffer is full. The record is filled before the
+*               head index is published, so Port_ReadTrace never sees a
+*               partial one.
+******************************************************************************/
+static void Port_TraceEvent(uint8 ServiceId, Port_PinType Pin, uint8 OldValue, uint8 NewValue)
+{
+    uint32 head = Port_TraceHead;
+
+    if ((head - Port_TraceTail) >= PORT_TRACE_BUFFER_SIZE)
+    {
+        Port_TraceLost++;
+        return;
     }
 
+    volatile Port_TraceRecordType* Entry = &Port_TraceBuffer[head & (PORT_TRACE_BUFFER_SIZE - 1U)];
+
+    Entry->Timestamp = DWT_CYCCNT_REG;
+    Entry->Pin = Pin;
+    Entry->ServiceId = ServiceId;
+    Entry->OldValue = OldValue;
+    Entry->NewValue = NewValue;
+
+    Port_TraceHead = head + 1U;
 }
+#endif
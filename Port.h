@@ -66,6 +66,45 @@
 #define PORT_INITIALIZED                          (1U)
 #define PORT_NOT_INITIALIZED                      (0U)
 
+/* ****************************************************************
+ * Hardware
+ * ****************************************************************/
+
+/*
+ * Number of GPIO ports of the device: PORTA..PORTF on the TM4C123GH6PM,
+ * PORTA..PORTQ (no I or O) on the TM4C1294NCPDT. Port sets are handled as
+ * 32-bit masks, one bit per port, so up to 32 ports are supported.
+ */
+#if (PORT_DEVICE_TM4C129 == STD_ON)
+#define PORT_NUMBER_OF_PORTS                      (15U)
+#else
+#define PORT_NUMBER_OF_PORTS                      (6U)
+#endif
+
+#if (PORT_NUMBER_OF_PORTS > 32U)
+    #error "PORT_NUMBER_OF_PORTS exceeds the width of the port masks"
+#endif
+
+/* Number of pins of a GPIO port */
+#define PORT_PINS_PER_PORT                        (8U)
+
+/* Pin ID returned by Port_GetPinId for a physical pin with no configured channel */
+#if (PORT_CONFIGURED_CHANNELS < 0xFFU)
+#define PORT_PIN_NOT_CONFIGURED                   ((Port_PinType)0xFFU)
+#elif (PORT_CONFIGURED_CHANNELS < 0xFFFFU)
+#define PORT_PIN_NOT_CONFIGURED                   ((Port_PinType)0xFFFFU)
+#else
+    #error "PORT_CONFIGURED_CHANNELS exceeds the range of Port_PinType"
+#endif
+
+#if (PORT_CONFIGURED_PARALLEL_BUSES > 0xFFU)
+    #error "PORT_CONFIGURED_PARALLEL_BUSES exceeds the range of Port_ParallelBusType"
+#endif
+
+#if ((PORT_TRACE_BUFFER_SIZE == 0U) || ((PORT_TRACE_BUFFER_SIZE & (PORT_TRACE_BUFFER_SIZE - 1U)) != 0U))
+    #error "PORT_TRACE_BUFFER_SIZE must be a power of 2"
+#endif
+
 /* ****************************************************************
  * Compatibilities
  * ****************************************************************/
@@ -113,6 +152,78 @@
 /* Service ID for Port_SetPinMode API */
 #define PORT_SET_PIN_MODE_SID               (uint8)(0x04)
 
+/* Service ID for Port_SetPinGroupDirection API (non-AUTOSAR) */
+#define PORT_SET_PIN_GROUP_DIRECTION_SID    (uint8)(0x05)
+
+/* Service ID for Port_SetPinGroupMode API (non-AUTOSAR) */
+#define PORT_SET_PIN_GROUP_MODE_SID         (uint8)(0x06)
+
+/* Service ID for Port_GetStatistics API (non-AUTOSAR) */
+#define PORT_GET_STATISTICS_SID             (uint8)(0x07)
+
+/* Service ID for Port_StartStream API (non-AUTOSAR) */
+#define PORT_START_STREAM_SID               (uint8)(0x08)
+
+/* Service ID for Port_StopStream API (non-AUTOSAR) */
+#define PORT_STOP_STREAM_SID                (uint8)(0x09)
+
+/* Service ID for Port_ValidateConfig API (non-AUTOSAR) */
+#define PORT_VALIDATE_CONFIG_SID            (uint8)(0x0A)
+
+/* Service ID for Port_GetPinId API (non-AUTOSAR) */
+#define PORT_GET_PIN_ID_SID                 (uint8)(0x0C)
+
+/* Service ID for Port_SwitchConfiguration API (non-AUTOSAR) */
+#define PORT_SWITCH_CONFIGURATION_SID       (uint8)(0x0B)
+
+/* Service ID for Port_SetPinNotification API (non-AUTOSAR) */
+#define PORT_SET_PIN_NOTIFICATION_SID       (uint8)(0x0D)
+
+/* Service ID for Port_GetSnapshot API (non-AUTOSAR) */
+#define PORT_GET_SNAPSHOT_SID               (uint8)(0x0E)
+
+/* Service ID for Port_SaveContext API (non-AUTOSAR) */
+#define PORT_SAVE_CONTEXT_SID               (uint8)(0x0F)
+
+/* Service ID for Port_RestoreContext API (non-AUTOSAR) */
+#define PORT_RESTORE_CONTEXT_SID            (uint8)(0x10)
+
+/* Service ID for Port_ReadTrace API (non-AUTOSAR) */
+#define PORT_READ_TRACE_SID                 (uint8)(0x11)
+
+/* Service ID for Port_MainFunction API (non-AUTOSAR) */
+#define PORT_MAIN_FUNCTION_SID              (uint8)(0x12)
+
+/* Service ID for Port_VerifyConfiguration API (non-AUTOSAR) */
+#define PORT_VERIFY_CONFIGURATION_SID       (uint8)(0x13)
+
+/* Service ID for Port_GetDriftStatistics API (non-AUTOSAR) */
+#define PORT_GET_DRIFT_STATISTICS_SID       (uint8)(0x14)
+
+/*
+ * Number of entries of the Port_GetStatistics table, indexed by service ID
+ * (0x00 up to this value - 1). Measured: 0x00 to 0x06, Port_SwitchConfiguration,
+ * Port_GetSnapshot, Port_SaveContext, Port_RestoreContext and
+ * Port_VerifyConfiguration; the other IDs always read a zero count.
+ */
+#define PORT_STATISTICS_SERVICES            (0x14U)
+
+/* ****************************************************************
+ * Drifted Registers (Port_DriftStatisticsType.DriftedRegisters)
+ * ****************************************************************/
+
+#define PORT_DRIFT_DIR                      (0x0001U)
+#define PORT_DRIFT_PULL_UP                  (0x0002U)
+#define PORT_DRIFT_PULL_DOWN                (0x0004U)
+#define PORT_DRIFT_DRIVE                    (0x0008U)   /* DR2R, DR4R or DR8R */
+#define PORT_DRIFT_SLEW_RATE                (0x0010U)
+#define PORT_DRIFT_ANALOG_MODE              (0x0020U)
+#define PORT_DRIFT_ALT_FUNC                 (0x0040U)
+#define PORT_DRIFT_CTL                      (0x0080U)
+#define PORT_DRIFT_OPEN_DRAIN               (0x0100U)
+#define PORT_DRIFT_DIGITAL_ENABLE           (0x0200U)
+#define PORT_DRIFT_INTERRUPT                (0x0400U)   /* IS, IBE, IEV or IM */
+
 /* ****************************************************************
  * DET ERROR CODES
  * ****************************************************************/
@@ -149,12 +260,19 @@ typedef uint8 Port_PortType;
 /* A type definition for Port_PinLevelType used by the PORT APIs */
 typedef uint8 Port_PinLevelType;
 
-/* A type definition for Port_PinType used by the PORT APIs */
+/* A type definition for Port_PinType used by the PORT APIs, wide enough for every configured channel */
+#if (PORT_CONFIGURED_CHANNELS < 0xFFU)
 typedef uint8 Port_PinType;
+#else
+typedef uint16 Port_PinType;
+#endif
 
 /* A type definition for Port_PinModeType used by the PORT APIs */
 typedef uint8 Port_PinModeType;
 
+/* A type definition for Port_ParallelBusType, the index of a bus in the ParallelBuses array */
+typedef uint8 Port_ParallelBusType;
+
 /*
  * @Name:           Port_PinDirectionType
  * @Kind:           Enumeration
@@ -184,6 +302,126 @@ typedef enum
     PULL_DOWN = 2
 } Port_InternalResistorType;
 
+/*
+ * @Name:           Port_PinDriveType
+ * @Kind:           Enumeration
+ * @Range:          0 - 2
+ * @Description:
+ * Defines the output drive strength of a pin (GPIODR2R/DR4R/DR8R).
+ * @Available via: PORT.h
+ */
+typedef enum
+{
+    PORT_PIN_DRIVE_2MA = 0,
+    PORT_PIN_DRIVE_4MA = 1,
+    PORT_PIN_DRIVE_8MA = 2
+} Port_PinDriveType;
+
+/*
+ * @Name:           Port_PinInterruptType
+ * @Kind:           Enumeration
+ * @Range:          0 - 5
+ * @Description:
+ * Defines the interrupt trigger of a pin (GPIOIS/IBE/IEV), NONE keeps the
+ * pin masked in GPIOIM.
+ * @Available via: PORT.h
+ */
+typedef enum
+{
+    PORT_PIN_INTERRUPT_NONE = 0,
+    PORT_PIN_INTERRUPT_RISING_EDGE = 1,
+    PORT_PIN_INTERRUPT_FALLING_EDGE = 2,
+    PORT_PIN_INTERRUPT_BOTH_EDGES = 3,
+    PORT_PIN_INTERRUPT_LOW_LEVEL = 4,
+    PORT_PIN_INTERRUPT_HIGH_LEVEL = 5
+} Port_PinInterruptType;
+
+/*
+ * @Name:           Port_PinNotificationType
+ * @Kind:           Pointer to function
+ * @Description:
+ * Notification called from the port interrupt handler when the interrupt of
+ * a pin fires. A level notification must remove the interrupt cause.
+ * @Available via: PORT.h
+ */
+typedef void (*Port_PinNotificationType)(void);
+
+/*
+ * @Name:           Port_BusType
+ * @Kind:           Enumeration
+ * @Range:          0 - 1
+ * @Description:
+ * Defines the bus aperture a GPIO port is accessed through.
+ * The AHB aperture allows back-to-back single-cycle accesses.
+ * @Available via: PORT.h
+ */
+typedef enum
+{
+    PORT_BUS_APB = 0,
+    PORT_BUS_AHB = 1
+} Port_BusType;
+
+#if (PORT_PACKED_CHANNEL_CONFIG == STD_ON)
+
+/*
+ * @Name:           Port_ConfigChannel
+ * @Kind:           32-bit encoded descriptor
+ * @Description:
+ * Packed configuration of one pin:
+ *   [3:0]   Port_Num              [6:4]   Ch_Num
+ *   [10:7]  Mode                  [11]    Direction
+ *   [12]    InitialValue          [13]    Direction_Changeable
+ *   [14]    Mode_Changeable       [16:15] Resistor
+ *   [18:17] Drive                 [19]    SlewRate
+ *   [20]    OpenDrain             [23:21] Interrupt
+ * Build entries with PORT_CHANNEL() and read them with the accessors below.
+ * @Available via:  Port.h
+ */
+typedef uint32 Port_ConfigChannel;
+
+#define PORT_CHANNEL_PORT_SHIFT                   (0U)
+#define PORT_CHANNEL_CH_SHIFT                     (4U)
+#define PORT_CHANNEL_MODE_SHIFT                   (7U)
+#define PORT_CHANNEL_DIRECTION_SHIFT              (11U)
+#define PORT_CHANNEL_LEVEL_SHIFT                  (12U)
+#define PORT_CHANNEL_DIRECTION_CHANGEABLE_SHIFT   (13U)
+#define PORT_CHANNEL_MODE_CHANGEABLE_SHIFT        (14U)
+#define PORT_CHANNEL_RESISTOR_SHIFT               (15U)
+#define PORT_CHANNEL_DRIVE_SHIFT                  (17U)
+#define PORT_CHANNEL_SLEW_RATE_SHIFT              (19U)
+#define PORT_CHANNEL_OPEN_DRAIN_SHIFT             (20U)
+#define PORT_CHANNEL_INTERRUPT_SHIFT              (21U)
+
+#define PORT_CHANNEL(PORT, CH, MODE, DIR, LEVEL, DIR_CHANGEABLE, MODE_CHANGEABLE, RESISTOR, \
+                     DRIVE, SLEW_RATE, OPEN_DRAIN, INTERRUPT) \
+    (  ((uint32)(PORT)            << PORT_CHANNEL_PORT_SHIFT)                 \
+     | ((uint32)(CH)              << PORT_CHANNEL_CH_SHIFT)                   \
+     | ((uint32)(MODE)            << PORT_CHANNEL_MODE_SHIFT)                 \
+     | ((uint32)(DIR)             << PORT_CHANNEL_DIRECTION_SHIFT)            \
+     | ((uint32)(LEVEL)           << PORT_CHANNEL_LEVEL_SHIFT)                \
+     | ((uint32)(DIR_CHANGEABLE)  << PORT_CHANNEL_DIRECTION_CHANGEABLE_SHIFT) \
+     | ((uint32)(MODE_CHANGEABLE) << PORT_CHANNEL_MODE_CHANGEABLE_SHIFT)      \
+     | ((uint32)(RESISTOR)        << PORT_CHANNEL_RESISTOR_SHIFT)             \
+     | ((uint32)(DRIVE)           << PORT_CHANNEL_DRIVE_SHIFT)                \
+     | ((uint32)(SLEW_RATE)       << PORT_CHANNEL_SLEW_RATE_SHIFT)            \
+     | ((uint32)(OPEN_DRAIN)      << PORT_CHANNEL_OPEN_DRAIN_SHIFT)           \
+     | ((uint32)(INTERRUPT)       << PORT_CHANNEL_INTERRUPT_SHIFT))
+
+#define PORT_CHANNEL_PORT_NUM(CH)                 ((Port_PortType)(((CH) >> PORT_CHANNEL_PORT_SHIFT) & 0x0FU))
+#define PORT_CHANNEL_CH_NUM(CH)                   ((Port_ChannelType)(((CH) >> PORT_CHANNEL_CH_SHIFT) & 0x07U))
+#define PORT_CHANNEL_MODE(CH)                     ((Port_PinModeType)(((CH) >> PORT_CHANNEL_MODE_SHIFT) & 0x0FU))
+#define PORT_CHANNEL_DIRECTION(CH)                ((Port_PinDirectionType)(((CH) >> PORT_CHANNEL_DIRECTION_SHIFT) & 0x01U))
+#define PORT_CHANNEL_INITIAL_VALUE(CH)            ((Port_PinLevelType)(((CH) >> PORT_CHANNEL_LEVEL_SHIFT) & 0x01U))
+#define PORT_CHANNEL_DIRECTION_CHANGEABLE(CH)     ((boolean)(((CH) >> PORT_CHANNEL_DIRECTION_CHANGEABLE_SHIFT) & 0x01U))
+#define PORT_CHANNEL_MODE_CHANGEABLE(CH)          ((boolean)(((CH) >> PORT_CHANNEL_MODE_CHANGEABLE_SHIFT) & 0x01U))
+#define PORT_CHANNEL_RESISTOR(CH)                 ((Port_InternalResistorType)(((CH) >> PORT_CHANNEL_RESISTOR_SHIFT) & 0x03U))
+#define PORT_CHANNEL_DRIVE(CH)                    ((Port_PinDriveType)(((CH) >> PORT_CHANNEL_DRIVE_SHIFT) & 0x03U))
+#define PORT_CHANNEL_SLEW_RATE(CH)                ((boolean)(((CH) >> PORT_CHANNEL_SLEW_RATE_SHIFT) & 0x01U))
+#define PORT_CHANNEL_OPEN_DRAIN(CH)               ((boolean)(((CH) >> PORT_CHANNEL_OPEN_DRAIN_SHIFT) & 0x01U))
+#define PORT_CHANNEL_INTERRUPT(CH)                ((Port_PinInterruptType)(((CH) >> PORT_CHANNEL_INTERRUPT_SHIFT) & 0x07U))
+
+#else
+
 typedef struct
 {
     Port_PortType Port_Num;         /* Port ID (PORTA, PORTB, etc.) */
@@ -194,8 +432,96 @@ typedef struct
     boolean Direction_Changeable;   /* TRUE = Can change direction */
     boolean Mode_Changeable;        /* TRUE = Can change mode */
     Port_InternalResistorType Resistor;
+    Port_PinDriveType Drive;        /* Output drive strength */
+    boolean SlewRate;               /* TRUE = Slew rate control (8 mA drive only) */
+    boolean OpenDrain;              /* TRUE = Open-drain output in every mode */
+    Port_PinInterruptType Interrupt; /* Interrupt trigger of the pin */
 } Port_ConfigChannel;
 
+#define PORT_CHANNEL(PORT, CH, MODE, DIR, LEVEL, DIR_CHANGEABLE, MODE_CHANGEABLE, RESISTOR, \
+                     DRIVE, SLEW_RATE, OPEN_DRAIN, INTERRUPT) \
+    { (PORT), (CH), (MODE), (DIR), (LEVEL), (DIR_CHANGEABLE), (MODE_CHANGEABLE), (RESISTOR), \
+      (DRIVE), (SLEW_RATE), (OPEN_DRAIN), (INTERRUPT) }
+
+#define PORT_CHANNEL_PORT_NUM(CH)                 ((CH).Port_Num)
+#define PORT_CHANNEL_CH_NUM(CH)                   ((CH).Ch_Num)
+#define PORT_CHANNEL_MODE(CH)                     ((CH).Mode)
+#define PORT_CHANNEL_DIRECTION(CH)                ((CH).Direction)
+#define PORT_CHANNEL_INITIAL_VALUE(CH)            ((CH).InitialValue)
+#define PORT_CHANNEL_DIRECTION_CHANGEABLE(CH)     ((CH).Direction_Changeable)
+#define PORT_CHANNEL_MODE_CHANGEABLE(CH)          ((CH).Mode_Changeable)
+#define PORT_CHANNEL_RESISTOR(CH)                 ((CH).Resistor)
+#define PORT_CHANNEL_DRIVE(CH)                    ((CH).Drive)
+#define PORT_CHANNEL_SLEW_RATE(CH)                ((CH).SlewRate)
+#define PORT_CHANNEL_OPEN_DRAIN(CH)               ((CH).OpenDrain)
+#define PORT_CHANNEL_INTERRUPT(CH)                ((CH).Interrupt)
+
+#endif
+
+typedef struct
+{
+    Port_BusType Bus;               /* Aperture used by the Port and Dio drivers */
+    boolean SleepClock;             /* TRUE = Port stays clocked in sleep mode (PORT_CLOCK_GATING) */
+    boolean DeepSleepClock;         /* TRUE = Port stays clocked in deep-sleep mode (PORT_CLOCK_GATING) */
+} Port_ConfigPort;
+
+/*
+ * @Name:           Port_PortImageType
+ * @Kind:           Structure
+ * @Description:
+ * Register image of one port, generated with the channel configuration and
+ * applied as is by Port_Init. Each "Mask" member selects the pins owned by
+ * the image in the matching register(s), the other members hold the value
+ * of those bits.
+ * @Available via:  Port.h
+ */
+typedef struct
+{
+    uint8  PinMask;                 /* Configured pins: owner of DIR */
+    uint8  CommitMask;              /* Locked pins (PD7/PF0) to be committed in GPIOCR */
+    uint8  Dir;                     /* Direction of the configured pins */
+    uint8  FixedDirMask;            /* Pins whose direction is not changeable */
+    uint8  FixedModeMask;           /* Pins whose mode is not changeable */
+    uint8  DataMask;                /* Output pins: owner of DATA */
+    uint8  Data;                    /* Initial level of the output pins */
+    uint8  ResistorMask;            /* Input pins with a pull resistor: owner of PUR/PDR */
+    uint8  PullUp;
+    uint8  PullDown;
+    uint8  ModeMask;                /* Pins with a mode: owner of DEN/AFSEL/AMSEL/ODR */
+    uint8  DigitalEnable;
+    uint8  AltFunc;
+    uint8  AnalogMode;
+    uint8  OpenDrain;               /* ODR of the pins in ModeMask: mode requirement or OpenDrainPins */
+    uint8  OpenDrainPins;           /* Pins configured open-drain in every mode */
+    uint8  Drive2;                  /* Pins driven at 2 mA: owner of DR2R */
+    uint8  Drive4;                  /* Pins driven at 4 mA: owner of DR4R */
+    uint8  Drive8;                  /* Pins driven at 8 mA: owner of DR8R */
+    uint8  SlewRate;                /* SLR of the configured pins */
+    uint8  InterruptMask;           /* Pins with an interrupt trigger: owner of IS/IBE/IEV, unmasked in IM */
+    uint8  InterruptSense;          /* IS: level (1) or edge (0) */
+    uint8  InterruptBothEdges;      /* IBE: both edges */
+    uint8  InterruptEvent;          /* IEV: rising edge / high level (1) or falling edge / low level (0) */
+    uint32 CtlMask;                 /* PCTL nibbles of the pins in ModeMask */
+    uint32 Ctl;
+} Port_PortImageType;
+
+/*
+ * @Name:           Port_ParallelBusConfigType
+ * @Kind:           Structure
+ * @Description:
+ * Pins of one port read or written as a whole through the GPIODATA alias
+ * of their mask. Bit n of a bus value drives pin Shift + n, so a contiguous
+ * mask gives a plain binary value; the bits of a value that fall outside an
+ * arbitrary mask are ignored by the hardware.
+ * @Available via:  Port.h
+ */
+typedef struct
+{
+    Port_PortType Port;             /* Port of the pins (0 => PORTA, 1 => PORTB, ...) */
+    uint8 PinMask;                  /* Pins of the bus, all configured in PIN_MODE_DIO */
+    uint8 Shift;                    /* Lowest pin of PinMask */
+} Port_ParallelBusConfigType;
+
 /*
  * @Name:           Port_ConfigType
  * @Kind:           Structure
@@ -207,8 +533,181 @@ typedef struct
 typedef struct
 {
     Port_ConfigChannel Pins[PORT_CONFIGURED_CHANNELS]; /* Array of pin configurations */
+    Port_ConfigPort Ports[PORT_NUMBER_OF_PORTS];       /* Array of port configurations */
+    Port_PortImageType Images[PORT_NUMBER_OF_PORTS];   /* Register image of every port */
+    Port_PinType PinIds[PORT_NUMBER_OF_PORTS][PORT_PINS_PER_PORT]; /* Pin ID + 1 of every physical pin, 0 = not configured */
+#if (PORT_CONFIGURED_PARALLEL_BUSES > 0U)
+    Port_ParallelBusConfigType ParallelBuses[PORT_CONFIGURED_PARALLEL_BUSES];
+#endif
 } Port_ConfigType;
 
+/*
+ * @Name:           Port_ParallelBusAccessType
+ * @Kind:           Structure
+ * @Description:
+ * Parallel bus resolved by Port_Init: the GPIODATA address masked to the
+ * bus pins on the aperture of its port, to be used with
+ * PORT_PARALLEL_BUS_WRITE and PORT_PARALLEL_BUS_READ.
+ * @Available via:  Port.h
+ */
+typedef struct
+{
+    volatile uint32* Data;          /* GPIODATA alias of PinMask */
+    uint8 PinMask;
+    uint8 Shift;
+} Port_ParallelBusAccessType;
+
+/* Drive all the pins of a bus with one store, the other pins of the port are left untouched */
+#define PORT_PARALLEL_BUS_WRITE(BUS, VALUE) \
+    (*(BUS)->Data = ((uint32)(VALUE) << (BUS)->Shift))
+
+/* Sample all the pins of a bus with one load, bit 0 being the lowest pin */
+#define PORT_PARALLEL_BUS_READ(BUS) \
+    ((uint8)(*(BUS)->Data >> (BUS)->Shift))
+
+/*
+ * @Name:           Port_PortSnapshotType
+ * @Kind:           Structure
+ * @Description:
+ * Register values of one port read back by Port_GetSnapshot.
+ * @Available via:  Port.h
+ */
+typedef struct
+{
+    uint32 Ctl;                     /* GPIOPCTL */
+    uint8  Dir;                     /* GPIODIR */
+    uint8  DigitalEnable;           /* GPIODEN */
+    uint8  AltFunc;                 /* GPIOAFSEL */
+    uint8  AnalogMode;              /* GPIOAMSEL */
+    uint8  PullUp;                  /* GPIOPUR */
+    uint8  PullDown;                /* GPIOPDR */
+    uint8  Data;                    /* GPIODATA, all the pins */
+} Port_PortSnapshotType;
+
+/*
+ * @Name:           Port_SnapshotType
+ * @Kind:           Structure
+ * @Description:
+ * State of all the configured ports, captured by Port_GetSnapshot. The
+ * entries of the ports outside PortMask are zero.
+ * @Available via:  Port.h
+ */
+typedef struct
+{
+    uint32 PortMask;                /* Captured ports (bit n => port n) */
+    Port_PortSnapshotType Ports[PORT_NUMBER_OF_PORTS];
+} Port_SnapshotType;
+
+/*
+ * @Name:           Port_PortContextType
+ * @Kind:           Structure
+ * @Description:
+ * Registers of one port saved by Port_SaveContext, written back as is by
+ * Port_RestoreContext.
+ * @Available via:  Port.h
+ */
+typedef struct
+{
+    uint32 Ctl;                     /* GPIOPCTL */
+    uint8  Data;                    /* GPIODATA */
+    uint8  Dir;                     /* GPIODIR */
+    uint8  PullUp;                  /* GPIOPUR */
+    uint8  PullDown;                /* GPIOPDR */
+    uint8  Drive2;                  /* GPIODR2R */
+    uint8  Drive4;                  /* GPIODR4R */
+    uint8  Drive8;                  /* GPIODR8R */
+    uint8  SlewRate;                /* GPIOSLR */
+    uint8  OpenDrain;               /* GPIOODR */
+    uint8  DigitalEnable;           /* GPIODEN */
+    uint8  AltFunc;                 /* GPIOAFSEL */
+    uint8  AnalogMode;              /* GPIOAMSEL */
+    uint8  InterruptSense;          /* GPIOIS */
+    uint8  InterruptBothEdges;      /* GPIOIBE */
+    uint8  InterruptEvent;          /* GPIOIEV */
+    uint8  InterruptMask;           /* GPIOIM */
+} Port_PortContextType;
+
+/*
+ * @Name:           Port_ContextType
+ * @Kind:           Structure
+ * @Description:
+ * Context of all the configured ports, to be placed in RAM retained in
+ * deep-sleep mode.
+ * @Available via:  Port.h
+ */
+typedef struct
+{
+    uint32 PortMask;                /* Saved ports (bit n => port n) */
+    uint32 AhbMask;                 /* Saved ports accessed through the AHB aperture */
+    Port_PortContextType Ports[PORT_NUMBER_OF_PORTS];
+} Port_ContextType;
+
+/*
+ * @Name:           Port_DriftStatisticsType
+ * @Kind:           Structure
+ * @Description:
+ * Register drift found on one port by Port_VerifyConfiguration.
+ * @Available via:  Port.h
+ */
+typedef struct
+{
+    uint32 DriftCount;              /* Verifications that found and repaired drifted bits */
+    uint32 LastDriftedRegisters;    /* PORT_DRIFT_* registers repaired by the last verification */
+    uint32 DriftedRegisters;        /* PORT_DRIFT_* registers repaired at least once */
+} Port_DriftStatisticsType;
+
+/*
+ * @Name:           Port_StatisticsType
+ * @Kind:           Structure
+ * @Description:
+ * Execution time of the completed calls of one Port service, in DWT cycles.
+ * @Available via:  Port.h
+ */
+typedef struct
+{
+    uint32 Count;                   /* Number of completed calls */
+    uint32 MinCycles;
+    uint32 MaxCycles;
+    uint32 AverageCycles;
+} Port_StatisticsType;
+
+/*
+ * @Name:           Port_TraceRecordType
+ * @Kind:           Structure
+ * @Description:
+ * One pin configuration change recorded by PORT_TRACE_API: the service that
+ * made it (PORT_SET_PIN_DIRECTION_SID, PORT_SET_PIN_MODE_SID,
+ * PORT_SET_PIN_GROUP_DIRECTION_SID, PORT_SET_PIN_GROUP_MODE_SID or
+ * PORT_REFRESH_PIN_DIRECTION_SID) and the direction or mode before and after.
+ * A group change makes one record per pin of the group.
+ * @Available via:  Port.h
+ */
+typedef struct
+{
+    uint32 Timestamp;               /* DWT cycle count of the change */
+    Port_PinType Pin;               /* Pin ID of the changed channel */
+    uint8 ServiceId;
+    uint8 OldValue;                 /* Port_PinDirectionType or Port_PinModeType */
+    uint8 NewValue;
+} Port_TraceRecordType;
+
+/*
+ * @Name:           Port_StreamConfigType
+ * @Kind:           Structure
+ * @Description:
+ * Binding of a group of configured pins to the uDMA channel that streams a
+ * buffer to them, one byte per request of the selected channel assignment
+ * (e.g. channel 18, encoding 0: Timer 0A timeout).
+ * @Available via:  Port.h
+ */
+typedef struct
+{
+    Port_PortType Port;             /* Port of the pins (0 => PORTA, 1 => PORTB, ...) */
+    uint8 PinMask;                  /* Pins driven by the stream, other bits of a sample are ignored */
+    uint8 DmaChannel;               /* uDMA channel (0..31) */
+    uint8 DmaEncoding;              /* Channel assignment selected in DMACHMAPn (0..4) */
+} Port_StreamConfigType;
+
 /*******************************************************************************
  *                      Function Prototypes                                    *
  *******************************************************************************/
@@ -218,6 +717,57 @@ void Port_setPinDirection(Port_PinType Pin, Port_PinDirectionType Direction);
 void Port_RefreshPortDirection(void);
 void Port_GetVersionInfo(Std_VersionInfoType* versioninfo);
 void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode);
+void Port_SetPinGroupDirection(Port_PortType Port, uint8 PinMask, Port_PinDirectionType Direction);
+void Port_SetPinGroupMode(Port_PortType Port, uint8 PinMask, Port_PinModeType Mode);
+volatile uint32* Port_GetPortBaseAddress(Port_PortType PortNum);
+Std_ReturnType Port_ValidateConfig(const Port_ConfigType* ConfigPtr);
+Std_ReturnType Port_SwitchConfiguration(const Port_ConfigType* ConfigPtr);
+Port_PinType Port_GetPinId(Port_PortType PortNum, uint8 ChannelNum);
+Std_ReturnType Port_GetSnapshot(Port_SnapshotType* Snapshot);
+Std_ReturnType Port_SaveContext(Port_ContextType* Context);
+Std_ReturnType Port_RestoreContext(const Port_ContextType* Context);
+Std_ReturnType Port_VerifyConfiguration(void);
+Std_ReturnType Port_GetDriftStatistics(Port_PortType Port, Port_DriftStatisticsType* Statistics);
+#if (PORT_CONFIGURED_PARALLEL_BUSES > 0U)
+const Port_ParallelBusAccessType* Port_GetParallelBus(Port_ParallelBusType Bus);
+#endif
+#if (PORT_INTERRUPT_API == STD_ON)
+void Port_SetPinNotification(Port_PinType Pin, Port_PinNotificationType Notification);
+
+/* Interrupt handlers of the GPIO ports, to be placed in the vector table */
+void Port_GpioPortA_Handler(void);
+void Port_GpioPortB_Handler(void);
+void Port_GpioPortC_Handler(void);
+void Port_GpioPortD_Handler(void);
+void Port_GpioPortE_Handler(void);
+void Port_GpioPortF_Handler(void);
+#if (PORT_DEVICE_TM4C129 == STD_ON)
+void Port_GpioPortG_Handler(void);
+void Port_GpioPortH_Handler(void);
+void Port_GpioPortJ_Handler(void);
+void Port_GpioPortK_Handler(void);
+void Port_GpioPortL_Handler(void);
+void Port_GpioPortM_Handler(void);
+void Port_GpioPortN_Handler(void);
+void Port_GpioPortP_Handler(void);
+void Port_GpioPortQ_Handler(void);
+#endif
+#endif
+#if (PORT_STATISTICS_API == STD_ON)
+Std_ReturnType Port_GetStatistics(uint8 ServiceId, Port_StatisticsType* Statistics);
+#endif
+#if (PORT_DEV_ERROR_DETECT == STD_ON) && (PORT_DEFERRED_ERROR_REPORT == STD_ON)
+void Port_MainFunction(void);
+uint16 Port_GetErrorCount(uint8 ServiceId, uint8 ErrorId);
+#endif
+#if (PORT_TRACE_API == STD_ON)
+Std_ReturnType Port_ReadTrace(Port_TraceRecordType* Record);
+uint32 Port_GetTraceLostCount(void);
+#endif
+#if (PORT_STREAM_API == STD_ON)
+Std_ReturnType Port_StartStream(const Port_StreamConfigType* Stream, const uint8* Buffer, uint16 Length);
+void Port_StopStream(const Port_StreamConfigType* Stream);
+#endif
 
 /*******************************************************************************
  *                       External Variables                                    *
@@ -21,14 +21,100 @@
 #define PORT_CFG_AR_RELEASE_MINOR_VERSION  (0U)
 #define PORT_CFG_AR_RELEASE_PATCH_VERSION  (3U)
 
+/*
+ * Target device: STD_OFF for the TM4C123GH6PM (PORTA..PORTF, APB or AHB),
+ * STD_ON for the TM4C1294NCPDT (PORTA..PORTQ, AHB only)
+ */
+#define PORT_DEVICE_TM4C129           (STD_OFF)
+
 /* Pre-compile or Post-Build Configuration Switches */
 #define PORT_DEV_ERROR_DETECT         (STD_ON)
 #define PORT_VERSION_INFO_API         (STD_OFF)
 
+/*
+ * Validate the whole configuration once in Port_Init, so the runtime APIs
+ * can trust the channel table and skip their per-call consistency checks
+ */
+#define PORT_VALIDATE_CONFIG          (STD_ON)
+
+/* Measure every Port API with the DWT cycle counter, readable through Port_GetStatistics */
+#define PORT_STATISTICS_API           (STD_OFF)
+
+/*
+ * Keep an SRAM shadow of the mode and direction registers, so runtime changes
+ * are single stores. Each shadow update and its store run with the interrupts
+ * masked (PRIMASK), which keeps them safe from preempting ISRs.
+ */
+#define PORT_SHADOW_REGISTERS         (STD_OFF)
+
+/*
+ * Let Port_Init own the GPIO clock gating: only the ports with configured
+ * pins are clocked, and the sleep/deep-sleep clocks come from the config
+ */
+#define PORT_CLOCK_GATING             (STD_OFF)
+
+/*
+ * Enable the NVIC line of the ports with interrupt pins and dispatch their
+ * interrupts to the notifications set by Port_SetPinNotification
+ */
+#define PORT_INTERRUPT_API            (STD_OFF)
+
+/*
+ * Record every pin direction and mode change, one record per pin for the
+ * group APIs, and every direction repaired by Port_RefreshPortDirection, in
+ * a lock-free ring buffer drained with Port_ReadTrace. Single producer: the
+ * traced services must all be called from the same priority level.
+ */
+#define PORT_TRACE_API                (STD_OFF)
+
+/* Number of records of the trace ring buffer, a power of 2 */
+#define PORT_TRACE_BUFFER_SIZE        (32U)
+
+/*
+ * Post the DET errors of the runtime services to a Port-local error table
+ * flushed by Port_MainFunction, instead of calling Det_ReportError from the
+ * caller's context (needs PORT_DEV_ERROR_DETECT)
+ */
+#define PORT_DEFERRED_ERROR_REPORT    (STD_OFF)
+
+/* Maximum number of Det_ReportError calls made by one Port_MainFunction call */
+#define PORT_DET_REPORTS_PER_CYCLE    (1U)
+
+/* Parallel output of a pin group driven by a uDMA channel through Port_StartStream */
+#define PORT_STREAM_API               (STD_OFF)
+
+/* Store each channel as a 32-bit encoded descriptor instead of a padded structure */
+#define PORT_PACKED_CHANNEL_CONFIG    (STD_OFF)
+
+/*
+ * Ports placed on the AHB aperture by the configuration, one bit per port,
+ * so that Port_Inline.h can resolve base addresses at compile time
+ */
+#define PORT_AHB_PORTS_MASK           (0x00U)
+
 /* Number of pins configured in the Port_ConfigType array */
 #define PORT_CONFIGURED_CHANNELS      (2U)
 
+/*
+ * Number of parallel buses configured in the Port_ConfigType array: groups
+ * of DIO pins of one port read or written with a single GPIODATA access
+ */
+#define PORT_CONFIGURED_PARALLEL_BUSES (0U)
+
+/* Pin modes, each one selecting a peripheral function through the mode table of Port.c */
 #define PIN_MODE_DIO                   (0U)
+#define PIN_MODE_UART                  (1U)
+#define PIN_MODE_SSI                   (2U)
+#define PIN_MODE_I2C                   (3U)
+#define PIN_MODE_M0PWM                 (4U)
+#define PIN_MODE_M1PWM                 (5U)
+#define PIN_MODE_CAN                   (6U)
+#define PIN_MODE_QEI                   (7U)
+#define PIN_MODE_ADC                   (8U)
+
+/* Number of pin modes */
+#define PORT_NUMBER_OF_MODES           (9U)
+
 /* Include Dio_Cfg.h so we can use the same numeric values for LED/Switch */
 #include "Dio_Cfg.h"
 
@@ -0,0 +1,91 @@
+/******************************************************************************
+ *  @file       Port_Inline.h
+ *  @author     Hassan Darwish
+ *  @date       Feb 2025
+ *  @brief      Inline fast path of the Port Driver for TIVA-C Cortex M4
+ *
+ *  @details
+ *  This header file resolves the port base address and the bit of a pin
+ *  named by compile-time constants (its Dio_Cfg.h port and channel numbers),
+ *  so changing its direction collapses to a single bit-band store. Variable
+ *  pin IDs keep using the AUTOSAR API of Port.h.
+ *
+ *  @warning    The fast path performs no DET check: the pin must be
+ *              configured as direction changeable and Port_Init must have run.
+ ******************************************************************************/
+
+/* ****************************************************************************
+ *  INCLUDE GUARD
+ * ****************************************************************************/
+#ifndef PORT_INLINE_H_
+#define PORT_INLINE_H_
+
+/* ****************************************************************************
+ *  INCLUDES
+ * ****************************************************************************/
+
+/* Port driver header file */
+#include "Port.h"
+
+/* Port registers header file */
+#include "Port_Regs.h"
+
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+  #error "Port_Inline.h bypasses the DIR shadow, it cannot be used with PORT_SHADOW_REGISTERS"
+#endif
+
+/* ****************************************************************************
+ *  MACRO DEFINITIONS
+ * ****************************************************************************/
+
+/* Base address of port PORT (0 => PORTA, 1 => PORTB, ...) on the aperture selected by PORT_AHB_PORTS_MASK */
+#if (PORT_DEVICE_TM4C129 == STD_ON)
+#define PORT_INLINE_BASE_ADDRESS(PORT) \
+    (GPIO_PORTA_AHB_BASE_ADDRESS + ((uint32)(PORT) * 0x1000U))
+#else
+#define PORT_INLINE_BASE_ADDRESS(PORT) \
+    ((((PORT_AHB_PORTS_MASK >> (PORT)) & 1U) != 0U) \
+        ? (GPIO_PORTA_AHB_BASE_ADDRESS + ((uint32)(PORT) * 0x1000U)) \
+        : (((PORT) < 4U) ? (GPIO_PORTA_BASE_ADDRESS + ((uint32)(PORT) * 0x1000U)) \
+                         : (GPIO_PORTE_BASE_ADDRESS + (((uint32)(PORT) - 4U) * 0x1000U))))
+#endif
+
+/* Bit-band alias of bit BIT of the register at OFFSET of port PORT */
+#define PORT_INLINE_BITBAND_REG(PORT, OFFSET, BIT) \
+    (*(volatile uint32*)(PERIPHERAL_BITBAND_BASE_ADDRESS \
+        + ((PORT_INLINE_BASE_ADDRESS(PORT) + (OFFSET) - PERIPHERAL_BASE_ADDRESS) * 32U) \
+        + ((uint32)(BIT) * 4U)))
+
+/*
+ * GPIODATA alias of the pins in MASK of port PORT, for a parallel bus named
+ * by constants: one store or load writes or reads all of its pins
+ */
+#define PORT_INLINE_DATA_REG(PORT, MASK) \
+    (*(volatile uint32*)(PORT_INLINE_BASE_ADDRESS(PORT) + PORT_DATA_MASKED_OFFSET(MASK)))
+
+/*
+ * Fast path of Port_setPinDirection for a pin named by its Dio symbol,
+ * e.g. PORT_SET_PIN_DIRECTION_FAST(DioConf_LED1, PORT_PIN_IN)
+ */
+#define PORT_SET_PIN_DIRECTION_FAST(DIO, DIRECTION) \
+    Port_InlineSetPinDirection(DIO##_PORT_NUM, DIO##_CHANNEL_NUM, (DIRECTION))
+
+/* ****************************************************************************
+ *  INLINE FUNCTIONS
+ * ****************************************************************************/
+
+/******************************************************************************
+* @Function Name: Port_InlineSetPinDirection
+* @Parameters (in): PortNum - Port of the pin (0 => PORTA, 1 => PORTB, ...), a constant
+*                   ChannelNum - Pin of the port (0..7), a constant
+*                   Direction - Port Pin Direction
+* @Return value: None
+* @Description: Sets the direction of a pin with one store to the bit-band
+*               alias of its DIR bit, the address being folded at compile time
+******************************************************************************/
+static inline void Port_InlineSetPinDirection(uint8 PortNum, uint8 ChannelNum, Port_PinDirectionType Direction)
+{
+    PORT_INLINE_BITBAND_REG(PortNum, PORT_DIR_REG_OFFSET, ChannelNum) = (Direction == PORT_PIN_OUT) ? 1U : 0U;
+}
+
+#endif /* PORT_INLINE_H_ */
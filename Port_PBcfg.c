@@ -7,6 +7,9 @@
  *  @details
  *  This source file contains the Post Build configurations and Module verison
  *  for the Port Driver for the AUTOSAR MCAL layer.
+ *
+ *  @warning    Generated by tools/Port_Generator.py from Port_PBcfg.json,
+ *              do not edit by hand.
  ******************************************************************************/
 
 /* ****************************************************************************
@@ -56,22 +59,63 @@
   #error "The SW version of PBcfg.c does not match the expected version"
 #endif
 
+/* ****************************************************************
+ * Generation Checks
+ * ****************************************************************/
+
+/* The channel count of Port_Cfg.h must match the generated channel table */
+#if (PORT_CONFIGURED_CHANNELS != 2U)
+  #error "PORT_CONFIGURED_CHANNELS does not match Port_PBcfg.json"
+#endif
+
+/* The parallel bus count of Port_Cfg.h must match the generated bus table */
+#if (PORT_CONFIGURED_PARALLEL_BUSES != 0U)
+  #error "PORT_CONFIGURED_PARALLEL_BUSES does not match Port_PBcfg.json"
+#endif
+
+/* Port_Cfg.h must select the device the pins were checked against */
+#if (PORT_DEVICE_TM4C129 != STD_OFF)
+  #error "PORT_DEVICE_TM4C129 does not match the TM4C123 device of Port_PBcfg.json"
+#endif
+
+/* The generator and the mode table of Port.c must describe the same modes */
+#if (PORT_NUMBER_OF_MODES != 9U)
+  #error "PORT_NUMBER_OF_MODES does not match the modes known to the generator"
+#endif
+
+/* Build fails on an array of negative size if COND does not hold */
+#define PORT_PBCFG_STATIC_ASSERT(COND, NAME)   typedef char NAME[(COND) ? 1 : -1]
+
+/* Port_Inline.h resolves the base addresses on the apertures of Port_Cfg.h */
+#if (PORT_AHB_PORTS_MASK != 0x00U)
+  #error "PORT_AHB_PORTS_MASK does not match the bus of Port_PBcfg.json"
+#endif
+
+/* The Dio channels must be the pins the image was generated for */
+PORT_PBCFG_STATIC_ASSERT((DioConf_LED1_PORT_NUM == 5U) && (DioConf_LED1_CHANNEL_NUM == 1U),
+                         Port_PBcfg_DioConf_LED1_Matches_PF1);
+PORT_PBCFG_STATIC_ASSERT((DioConf_SW1_PORT_NUM == 5U) && (DioConf_SW1_CHANNEL_NUM == 4U),
+                         Port_PBcfg_DioConf_SW1_Matches_PF4);
+
 
 const Port_ConfigType Port_Configuration =
 {
     .Pins =
     {
-        {
+        PORT_CHANNEL(   /* LED1: PF1 */
             DioConf_LED1_PORT_NUM,
             DioConf_LED1_CHANNEL_NUM,
-            PIN_MODE_DIO,      /* e.g., #define PIN_MODE_DIO 0U */
+            PIN_MODE_DIO,
             PORT_PIN_OUT,
             STD_HIGH,
             TRUE,
             TRUE,
-            RESISTOR_OFF
-        },
-        {
+            RESISTOR_OFF,
+            PORT_PIN_DRIVE_2MA,
+            FALSE,
+            FALSE,
+            PORT_PIN_INTERRUPT_NONE),
+        PORT_CHANNEL(   /* SW1: PF4 */
             DioConf_SW1_PORT_NUM,
             DioConf_SW1_CHANNEL_NUM,
             PIN_MODE_DIO,
@@ -79,10 +123,54 @@ const Port_ConfigType Port_Configuration =
             STD_LOW,
             FALSE,
             TRUE,
-            PULL_UP
+            PULL_UP,
+            PORT_PIN_DRIVE_2MA,
+            FALSE,
+            FALSE,
+            PORT_PIN_INTERRUPT_NONE)
+    },
+    .Ports =
+    {
+        { PORT_BUS_APB, FALSE, FALSE },   /* PORTA */
+        { PORT_BUS_APB, FALSE, FALSE },   /* PORTB */
+        { PORT_BUS_APB, FALSE, FALSE },   /* PORTC */
+        { PORT_BUS_APB, FALSE, FALSE },   /* PORTD */
+        { PORT_BUS_APB, FALSE, FALSE },   /* PORTE */
+        { PORT_BUS_APB, TRUE,  FALSE }    /* PORTF */
+    },
+    .Images =
+    {
+        {   /* PORTA: not used */
+            0U
+        },
+        {   /* PORTB: not used */
+            0U
+        },
+        {   /* PORTC: not used */
+            0U
+        },
+        {   /* PORTD: not used */
+            0U
+        },
+        {   /* PORTE: not used */
+            0U
+        },
+        {   /* PORTF */
+            .PinMask            = 0x12U,
+            .Dir                = 0x02U,
+            .FixedDirMask       = 0x10U,
+            .DataMask           = 0x02U,
+            .Data               = 0x02U,
+            .ResistorMask       = 0x10U,
+            .PullUp             = 0x10U,
+            .ModeMask           = 0x12U,
+            .DigitalEnable      = 0x12U,
+            .Drive2             = 0x12U,
+            .CtlMask            = 0x000F00F0U
         }
+    },
+    .PinIds =
+    {
+        [5] = { [1] = 1U, [4] = 2U }    /* PORTF: LED1, SW1 */
     }
 };
-
-
-
@@ -0,0 +1,185 @@
+/******************************************************************************
+ *  @file       Port_Regs.h
+ *  @author     Hassan Darwish
+ *  @date       Feb 2025
+ *  @brief      the Registers Header file for Port Driver of TIVA-C Cortex M4
+ *
+ *  @details
+ *  This Header file contains the base addresses and register offsets of the
+ *  GPIO ports and the System Control registers used by the Port Driver.
+ ******************************************************************************/
+#ifndef PORT_REGS_H_
+#define PORT_REGS_H_
+
+#include <stdint.h>
+
+#include "Std_Types.h"
+
+/* ****************************************************************
+ * GPIO Base Addresses (APB aperture)
+ * ****************************************************************/
+
+#define GPIO_PORTA_BASE_ADDRESS           (0x40004000U)
+#define GPIO_PORTB_BASE_ADDRESS           (0x40005000U)
+#define GPIO_PORTC_BASE_ADDRESS           (0x40006000U)
+#define GPIO_PORTD_BASE_ADDRESS           (0x40007000U)
+#define GPIO_PORTE_BASE_ADDRESS           (0x40024000U)
+#define GPIO_PORTF_BASE_ADDRESS           (0x40025000U)
+
+/* ****************************************************************
+ * GPIO Base Addresses (AHB aperture)
+ * ****************************************************************/
+
+#define GPIO_PORTA_AHB_BASE_ADDRESS       (0x40058000U)
+#define GPIO_PORTB_AHB_BASE_ADDRESS       (0x40059000U)
+#define GPIO_PORTC_AHB_BASE_ADDRESS       (0x4005A000U)
+#define GPIO_PORTD_AHB_BASE_ADDRESS       (0x4005B000U)
+#define GPIO_PORTE_AHB_BASE_ADDRESS       (0x4005C000U)
+#define GPIO_PORTF_AHB_BASE_ADDRESS       (0x4005D000U)
+
+/* TM4C129 only: its GPIO ports are reached through the AHB aperture alone */
+#define GPIO_PORTG_AHB_BASE_ADDRESS       (0x4005E000U)
+#define GPIO_PORTH_AHB_BASE_ADDRESS       (0x4005F000U)
+#define GPIO_PORTJ_AHB_BASE_ADDRESS       (0x40060000U)
+#define GPIO_PORTK_AHB_BASE_ADDRESS       (0x40061000U)
+#define GPIO_PORTL_AHB_BASE_ADDRESS       (0x40062000U)
+#define GPIO_PORTM_AHB_BASE_ADDRESS       (0x40063000U)
+#define GPIO_PORTN_AHB_BASE_ADDRESS       (0x40064000U)
+#define GPIO_PORTP_AHB_BASE_ADDRESS       (0x40065000U)
+#define GPIO_PORTQ_AHB_BASE_ADDRESS       (0x40066000U)
+
+/* ****************************************************************
+ * GPIO Register Offsets
+ * ****************************************************************/
+
+#define PORT_DATA_REG_OFFSET              (0x3FCU)
+#define PORT_DIR_REG_OFFSET               (0x400U)
+#define PORT_INT_SENSE_REG_OFFSET         (0x404U)
+#define PORT_INT_BOTH_EDGES_REG_OFFSET    (0x408U)
+#define PORT_INT_EVENT_REG_OFFSET         (0x40CU)
+#define PORT_INT_MASK_REG_OFFSET          (0x410U)
+#define PORT_INT_RAW_STATUS_REG_OFFSET    (0x414U)
+#define PORT_INT_MASKED_STATUS_REG_OFFSET (0x418U)
+#define PORT_INT_CLEAR_REG_OFFSET         (0x41CU)
+#define PORT_ALT_FUNC_REG_OFFSET          (0x420U)
+#define PORT_OPEN_DRAIN_REG_OFFSET        (0x50CU)
+#define PORT_DRIVE_2MA_REG_OFFSET         (0x500U)
+#define PORT_DRIVE_4MA_REG_OFFSET         (0x504U)
+#define PORT_DRIVE_8MA_REG_OFFSET         (0x508U)
+#define PORT_PULL_UP_REG_OFFSET           (0x510U)
+#define PORT_PULL_DOWN_REG_OFFSET         (0x514U)
+#define PORT_SLEW_RATE_REG_OFFSET         (0x518U)
+#define PORT_DIGITAL_ENABLE_REG_OFFSET    (0x51CU)
+#define PORT_LOCK_REG_OFFSET              (0x520U)
+#define PORT_COMMIT_REG_OFFSET            (0x524U)
+#define PORT_ANALOG_MODE_SEL_REG_OFFSET   (0x528U)
+#define PORT_CTL_REG_OFFSET               (0x52CU)
+
+/* TM4C129 only: Select Interrupt, SUM routes all the pins of PORTP/PORTQ to one line */
+#define PORT_SELECT_INTERRUPT_REG_OFFSET  (0x538U)
+#define PORT_SELECT_INTERRUPT_SUM         (0x01U)
+
+/*
+ * GPIODATA is aliased over 256 addresses: address bits [9:2] mask the bits
+ * affected by an access, so a store only changes the pins selected in MASK
+ */
+#define PORT_DATA_MASKED_OFFSET(MASK)     ((uint32)(MASK) << 2U)
+
+/* ****************************************************************
+ * Cortex-M4 Bit-Band Region
+ * ****************************************************************/
+
+/* Peripheral region covering both GPIO apertures, and its bit-band alias */
+#define PERIPHERAL_BASE_ADDRESS           (0x40000000U)
+#define PERIPHERAL_BITBAND_BASE_ADDRESS   (0x42000000U)
+
+/* ****************************************************************
+ * System Control Registers
+ * ****************************************************************/
+
+/* GPIO Run Mode Clock Gating Control */
+#define SYSCTL_RCGCGPIO_REG               (*((volatile uint32 *)0x400FE608U))
+
+/* GPIO Sleep Mode and Deep-Sleep Mode Clock Gating Control */
+#define SYSCTL_SCGCGPIO_REG               (*((volatile uint32 *)0x400FE708U))
+#define SYSCTL_DCGCGPIO_REG               (*((volatile uint32 *)0x400FE808U))
+
+/* uDMA Run Mode Clock Gating Control and Peripheral Ready */
+#define SYSCTL_RCGCDMA_REG                (*((volatile uint32 *)0x400FE60CU))
+#define SYSCTL_PRDMA_REG                  (*((volatile uint32 *)0x400FEA0CU))
+
+/* GPIO Peripheral Ready: one bit per port, 1 = the port can be accessed */
+#define SYSCTL_PRGPIO_REG                 (*((volatile uint32 *)0x400FEA08U))
+
+/* GPIO High-Performance Bus Control: one bit per port, 1 = AHB aperture */
+#define SYSCTL_GPIOHBCTL_REG              (*((volatile uint32 *)0x400FE06CU))
+
+/* ****************************************************************
+ * uDMA Controller Registers
+ * ****************************************************************/
+
+#define UDMA_STAT_REG                     (*((volatile uint32 *)0x400FF000U))
+#define UDMA_CFG_REG                      (*((volatile uint32 *)0x400FF004U))
+#define UDMA_CTLBASE_REG                  (*((volatile uint32 *)0x400FF008U))
+#define UDMA_USEBURSTCLR_REG              (*((volatile uint32 *)0x400FF01CU))
+#define UDMA_REQMASKCLR_REG               (*((volatile uint32 *)0x400FF024U))
+#define UDMA_ENASET_REG                   (*((volatile uint32 *)0x400FF028U))
+#define UDMA_ENACLR_REG                   (*((volatile uint32 *)0x400FF02CU))
+#define UDMA_ALTCLR_REG                   (*((volatile uint32 *)0x400FF034U))
+#define UDMA_PRIOCLR_REG                  (*((volatile uint32 *)0x400FF03CU))
+
+/* Channel Map Select n: 4 bits per channel, 8 channels per register */
+#define UDMA_CHMAP_REG(N)                 (*((volatile uint32 *)(0x400FF510U + ((uint32)(N) * 4U))))
+
+/* Master enable, in DMASTAT (read) and DMACFG (write) */
+#define UDMA_MASTER_ENABLE                (0x00000001U)
+
+/* Bus address of a CPU pointer handed to the uDMA controller, and the CPU pointer of such an address */
+#define PORT_DMA_ADDRESS(PTR)             ((uint32)(uintptr_t)(PTR))
+#define PORT_DMA_POINTER(ADDR)            ((void*)(uintptr_t)(ADDR))
+
+/* ****************************************************************
+ * Cortex-M4 NVIC Registers
+ * ****************************************************************/
+
+/* Interrupt Set Enable for interrupts 0 to 31 (all the GPIO port interrupts of the TM4C123) */
+#define NVIC_EN0_REG                      (*((volatile uint32 *)0xE000E100U))
+
+/* Interrupt Set Enable n, for interrupts 32 * n to 32 * n + 31 */
+#define NVIC_EN_REG(N)                    (*((volatile uint32 *)(0xE000E100U + ((uint32)(N) * 4U))))
+
+/* Interrupt numbers of the GPIO ports */
+#define NVIC_GPIO_PORTA_IRQ               (0U)
+#define NVIC_GPIO_PORTB_IRQ               (1U)
+#define NVIC_GPIO_PORTC_IRQ               (2U)
+#define NVIC_GPIO_PORTD_IRQ               (3U)
+#define NVIC_GPIO_PORTE_IRQ               (4U)
+#define NVIC_GPIO_PORTF_IRQ               (30U)
+
+/* TM4C129 only: PORTP and PORTQ use their summary interrupt (the one of pin 0) */
+#define NVIC_GPIO_PORTG_IRQ               (31U)
+#define NVIC_GPIO_PORTH_IRQ               (32U)
+#define NVIC_GPIO_PORTJ_IRQ               (51U)
+#define NVIC_GPIO_PORTK_IRQ               (52U)
+#define NVIC_GPIO_PORTL_IRQ               (53U)
+#define NVIC_GPIO_PORTM_IRQ               (72U)
+#define NVIC_GPIO_PORTN_IRQ               (73U)
+#define NVIC_GPIO_PORTP_IRQ               (76U)
+#define NVIC_GPIO_PORTQ_IRQ               (84U)
+
+/* ****************************************************************
+ * Cortex-M4 Debug Registers
+ * ****************************************************************/
+
+/* Debug Exception and Monitor Control: TRCENA enables the DWT unit */
+#define CORE_DEMCR_REG                    (*((volatile uint32 *)0xE000EDFCU))
+#define CORE_DEMCR_TRCENA                 (0x01000000U)
+
+/* DWT Control: CYCCNTENA starts the cycle counter */
+#define DWT_CTRL_REG                      (*((volatile uint32 *)0xE0001000U))
+#define DWT_CTRL_CYCCNTENA                (0x00000001U)
+
+/* DWT Cycle Count */
+#define DWT_CYCCNT_REG                    (*((volatile uint32 *)0xE0001004U))
+
+#endif /* PORT_REGS_H_ */
@@ -0,0 +1,304 @@
+/******************************************************************************
+ *  @file       Port_Bench.c
+ *  @brief      Host benchmark of the Port Driver register accesses
+ *
+ *  @details
+ *  Runs Port_Init and every runtime service over the synthetic variants of
+ *  Port_BenchConfig.py against the simulated register file, and prints the
+ *  volatile reads and writes each call made. Register accesses are a stable
+ *  proxy for the on-target cycles: `make check` compares the report with
+ *  expected/<DEVICE>-<PINS_PER_PORT>.txt to gate regressions.
+ *
+ *  Drift is injected into the fixed-direction and fixed-mode pins before
+ *  Port_RefreshPortDirection and Port_VerifyConfiguration, so their repair
+ *  paths are measured next to their no-drift paths. With PORT_STREAM_API a
+ *  stream is run through the simulated uDMA controller (Sim_RunDma).
+ *
+ *  The benchmark fails if a service reports a DET error, if the registers
+ *  do not match the generated image after Port_Init, a switch or a repair,
+ *  or if the injected drift is not found.
+ ******************************************************************************/
+
+#include <stdio.h>
+
+#include "Port.h"
+#include "Sim_Regs.h"
+
+extern const Port_ConfigType Port_BenchPeripheral;
+extern const Port_ConfigType Port_BenchInputs;
+
+static uint32 Bench_DetErrors = 0U;
+
+Std_ReturnType Det_ReportError(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId)
+{
+    (void)ModuleId;
+    (void)InstanceId;
+    printf("DET error: service 0x%02X, error 0x%02X\n", ApiId, ErrorId);
+    Bench_DetErrors++;
+    return E_OK;
+}
+
+/* Print the accesses of CALLS calls made since the last Sim_StartCount */
+static void Bench_Report(const char* Service, uint32 Calls)
+{
+    Sim_CountersType count = Sim_ReadCount();
+
+    printf("%-40s %6u %8u %8u\n", Service, Calls, count.Reads, count.Writes);
+    Sim_StartCount();
+}
+
+/* Flip the direction of the fixed-direction pins, and with MODES the digital enable and drive of the fixed-mode pins */
+static void Bench_InjectDrift(const Port_ConfigType* ConfigPtr, boolean Modes)
+{
+    Port_PortType port;
+
+    for (port = 0U; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+        const Port_PortImageType* Image = &ConfigPtr->Images[port];
+        volatile uint32* Base = Port_GetPortBaseAddress(port);
+
+        if ((Image->PinMask == 0U) || (Base == NULL_PTR))
+        {
+            continue;
+        }
+        PORT_REG(Base, PORT_DIR_REG_OFFSET) ^= Image->FixedDirMask;
+        if (Modes == TRUE)
+        {
+            PORT_REG(Base, PORT_DIGITAL_ENABLE_REG_OFFSET) ^= (uint32)(Image->FixedModeMask & Image->ModeMask);
+            PORT_REG(Base, PORT_DRIVE_2MA_REG_OFFSET) &= ~(uint32)Image->Drive2;
+        }
+    }
+
+    /* The injection itself is not part of the measured service */
+    Sim_StartCount();
+}
+
+/* Check the DIR, DEN, AFSEL and PUR registers of every used port against the image of ConfigPtr */
+static int Bench_CheckImage(const Port_ConfigType* ConfigPtr, const char* Name)
+{
+    int failures = 0;
+    Port_PortType port;
+
+    for (port = 0U; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+        const Port_PortImageType* Image = &ConfigPtr->Images[port];
+        volatile uint32* Base = Port_GetPortBaseAddress(port);
+
+        if ((Image->PinMask == 0U) || (Base == NULL_PTR))
+        {
+            continue;
+        }
+        if (((PORT_REG(Base, PORT_DIR_REG_OFFSET) & Image->PinMask) != Image->Dir) ||
+            ((PORT_REG(Base, PORT_DIGITAL_ENABLE_REG_OFFSET) & Image->ModeMask) != Image->DigitalEnable) ||
+            ((PORT_REG(Base, PORT_ALT_FUNC_REG_OFFSET) & Image->ModeMask) != Image->AltFunc) ||
+            ((PORT_REG(Base, PORT_PULL_UP_REG_OFFSET) & Image->ResistorMask) != Image->PullUp))
+        {
+            printf("%s: port %u does not match its image\n", Name, port);
+            failures++;
+        }
+    }
+    return failures;
+}
+
+#if (PORT_STATISTICS_API == STD_ON)
+/* Check every measured service recorded each of its bench calls */
+static int Bench_CheckStatistics(void)
+{
+    static const struct
+    {
+        uint8 ServiceId;
+        uint32 Calls;
+    } Expected[] = {
+        { PORT_INIT_SID, 1U },
+        { PORT_REFRESH_PIN_DIRECTION_SID, 2U },
+        { PORT_GET_SNAPSHOT_SID, 1U },
+        { PORT_SAVE_CONTEXT_SID, 1U },
+        { PORT_RESTORE_CONTEXT_SID, 1U },
+        { PORT_VERIFY_CONFIGURATION_SID, 2U },
+        { PORT_SWITCH_CONFIGURATION_SID, 3U },
+    };
+    Port_StatisticsType Statistics;
+    uint32 index;
+    int failures = 0;
+
+    for (index = 0U; index < (uint32)(sizeof(Expected) / sizeof(Expected[0])); index++)
+    {
+        if ((Port_GetStatistics(Expected[index].ServiceId, &Statistics) != E_OK) ||
+            (Statistics.Count != Expected[index].Calls))
+        {
+            printf("Port_GetStatistics: service 0x%02X measured %u of %u calls\n",
+                   (uint32)Expected[index].ServiceId, (uint32)Statistics.Count, Expected[index].Calls);
+            failures++;
+        }
+    }
+    return failures;
+}
+#endif
+
+#if (PORT_STREAM_API == STD_ON)
+/* Stream a pattern to the pins of the first configured port, then check the last sample reached GPIODATA */
+static int Bench_Stream(const Port_ConfigType* ConfigPtr)
+{
+    static const uint8 Samples[] = { 0x00U, 0xFFU, 0x55U, 0xAAU, 0x0FU, 0xF0U, 0x5AU };
+    Port_StreamConfigType Stream = { 0U, 0U, 18U, 0U };
+    volatile uint32* Base;
+    uint32 items;
+
+    while ((Stream.Port < PORT_NUMBER_OF_PORTS) && (ConfigPtr->Images[Stream.Port].PinMask == 0U))
+    {
+        Stream.Port++;
+    }
+    if (Stream.Port == PORT_NUMBER_OF_PORTS)
+    {
+        return 0;
+    }
+    Stream.PinMask = ConfigPtr->Images[Stream.Port].PinMask;
+    Base = Port_GetPortBaseAddress(Stream.Port);
+    Sim_StartCount();
+
+    if (Port_StartStream(&Stream, Samples, (uint16)sizeof(Samples)) != E_OK)
+    {
+        printf("Port_StartStream: stream refused\n");
+        return 1;
+    }
+    Bench_Report("Port_StartStream", 1U);
+
+    items = Sim_RunDma(Stream.DmaChannel);
+    if ((items != sizeof(Samples)) ||
+        ((PORT_REG(Base, PORT_DATA_REG_OFFSET) & Stream.PinMask) != (Samples[sizeof(Samples) - 1U] & Stream.PinMask)))
+    {
+        printf("Port_StartStream: %u of %u samples streamed, GPIODATA 0x%02X\n", items, (uint32)sizeof(Samples),
+               PORT_REG(Base, PORT_DATA_REG_OFFSET) & 0xFFU);
+        return 1;
+    }
+
+    /* Stopping the channel at any point leaves the last sample on the pins */
+    Sim_StartCount();
+    Port_StopStream(&Stream);
+    Bench_Report("Port_StopStream", 1U);
+    return 0;
+}
+#endif
+
+int main(void)
+{
+    Port_SnapshotType snapshot;
+    Port_ContextType context;
+    Port_PinType pin_id;
+    Port_PortType port;
+    uint32 calls = 0U;
+    uint32 ports = 0U;
+    int failures = 0;
+
+    Sim_Reset();
+
+    printf("Port driver register accesses: %u channels, %u ports\n",
+           (uint32)PORT_CONFIGURED_CHANNELS, (uint32)PORT_NUMBER_OF_PORTS);
+    printf("%-40s %6s %8s %8s\n", "service", "calls", "reads", "writes");
+
+    Port_Init(&Port_Configuration);
+    Bench_Report("Port_Init", 1U);
+    failures += Bench_CheckImage(&Port_Configuration, "Port_Init");
+
+    for (pin_id = 0U; pin_id < PORT_CONFIGURED_CHANNELS; pin_id++)
+    {
+        if (PORT_CHANNEL_DIRECTION_CHANGEABLE(Port_Configuration.Pins[pin_id]) == TRUE)
+        {
+            Port_setPinDirection(pin_id, PORT_PIN_IN);
+            calls++;
+        }
+    }
+    Bench_Report("Port_setPinDirection", calls);
+
+    Port_RefreshPortDirection();
+    Bench_Report("Port_RefreshPortDirection", 1U);
+
+    Bench_InjectDrift(&Port_Configuration, FALSE);
+    Port_RefreshPortDirection();
+    Bench_Report("Port_RefreshPortDirection (drift)", 1U);
+
+    calls = 0U;
+    for (pin_id = 0U; pin_id < PORT_CONFIGURED_CHANNELS; pin_id++)
+    {
+        if (PORT_CHANNEL_MODE_CHANGEABLE(Port_Configuration.Pins[pin_id]) == TRUE)
+        {
+            Port_SetPinMode(pin_id, PIN_MODE_DIO);
+            calls++;
+        }
+    }
+    Bench_Report("Port_SetPinMode", calls);
+
+    for (port = 0U; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+        const Port_PortImageType* Image = &Port_Configuration.Images[port];
+        uint8 pinMask = Image->PinMask & (uint8)~Image->FixedDirMask;
+
+        if (pinMask != 0U)
+        {
+            Port_SetPinGroupDirection(port, pinMask, PORT_PIN_OUT);
+            ports++;
+        }
+    }
+    Bench_Report("Port_SetPinGroupDirection", ports);
+
+    ports = 0U;
+    for (port = 0U; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+        const Port_PortImageType* Image = &Port_Configuration.Images[port];
+        uint8 pinMask = Image->PinMask & (uint8)~Image->FixedModeMask;
+
+        if (pinMask != 0U)
+        {
+            Port_SetPinGroupMode(port, pinMask, PIN_MODE_DIO);
+            ports++;
+        }
+    }
+    Bench_Report("Port_SetPinGroupMode", ports);
+
+    (void)Port_GetSnapshot(&snapshot);
+    Bench_Report("Port_GetSnapshot", 1U);
+
+    (void)Port_SaveContext(&context);
+    Bench_Report("Port_SaveContext", 1U);
+
+    (void)Port_RestoreContext(&context);
+    Bench_Report("Port_RestoreContext", 1U);
+
+    Bench_InjectDrift(&Port_Configuration, TRUE);
+    if (Port_VerifyConfiguration() != E_NOT_OK)
+    {
+        printf("Port_VerifyConfiguration: injected drift not found\n");
+        failures++;
+    }
+    Bench_Report("Port_VerifyConfiguration (drift)", 1U);
+    failures += Bench_CheckImage(&Port_Configuration, "Port_VerifyConfiguration (drift)");
+
+    (void)Port_SwitchConfiguration(&Port_BenchPeripheral);
+    Bench_Report("Port_SwitchConfiguration (peripheral)", 1U);
+    failures += Bench_CheckImage(&Port_BenchPeripheral, "Port_SwitchConfiguration (peripheral)");
+
+    (void)Port_SwitchConfiguration(&Port_BenchInputs);
+    Bench_Report("Port_SwitchConfiguration (inputs)", 1U);
+    failures += Bench_CheckImage(&Port_BenchInputs, "Port_SwitchConfiguration (inputs)");
+
+    (void)Port_SwitchConfiguration(&Port_Configuration);
+    Bench_Report("Port_SwitchConfiguration (outputs)", 1U);
+    failures += Bench_CheckImage(&Port_Configuration, "Port_SwitchConfiguration (outputs)");
+
+    if (Port_VerifyConfiguration() != E_OK)
+    {
+        printf("Port_VerifyConfiguration: drift found after the switches\n");
+        failures++;
+    }
+    Bench_Report("Port_VerifyConfiguration (no drift)", 1U);
+
+#if (PORT_STREAM_API == STD_ON)
+    failures += Bench_Stream(&Port_Configuration);
+#endif
+
+#if (PORT_STATISTICS_API == STD_ON)
+    failures += Bench_CheckStatistics();
+#endif
+
+    return ((failures == 0) && (Bench_DetErrors == 0U)) ? 0 : 1;
+}
@@ -0,0 +1,105 @@
+#!/usr/bin/env python3
+"""
+Port_BenchConfig.py - Synthetic configurations of the Port Driver host benchmark.
+
+Writes a Port_PBcfg.json that configures every bonded, non-JTAG pin of the
+device known to tools/Port_Generator.py (or only the first PINS of each port)
+in three variants, and the matching Port_Cfg.h:
+    Port_Configuration    every pin a DIO output; every other pin has a fixed
+                          direction and every other pair a fixed mode, so
+                          the refresh and drift repair paths have work to do
+    Port_BenchPeripheral  every pin on its first alternate function
+    Port_BenchInputs      every pin a DIO input with a pull-up and a both-edges interrupt
+
+Usage:
+    python3 Port_BenchConfig.py CFG_H OUTPUT_DIR [--device NAME] [--pins-per-port PINS]
+                                [--set NAME=VALUE ...]
+"""
+
+import argparse
+import json
+import os
+import re
+import sys
+
+sys.dont_write_bytecode = True
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..", "tools"))
+import Port_Generator as generator  # noqa: E402
+
+
+def bench_pins(pins_per_port):
+    pins = []
+    for port in generator.PORTS:
+        usable = [channel for channel in range(generator.PINS_PER_PORT)
+                  if "P%s%d" % (port, channel) in generator.PIN_FUNCTIONS
+                  and (port, channel) not in generator.JTAG_PINS]
+        pins += [("P%s%d" % (port, channel), port, channel) for channel in usable[:pins_per_port]]
+    return pins
+
+
+def variant(name, pins, describe):
+    return {"name": name, "pins": [dict(describe(index, pin), name=pin[0], port=pin[1], channel=pin[2])
+                                   for index, pin in enumerate(pins)]}
+
+
+def dio_output(index, pin):
+    return {"mode": "DIO", "direction": "OUT", "level": "HIGH",
+            "direction_changeable": index % 2 == 0, "mode_changeable": index % 4 < 2}
+
+
+def peripheral(index, pin):
+    functions = list(generator.PIN_FUNCTIONS[pin[0]])
+    if not functions:
+        return dict(dio_output(index, pin), direction_changeable=True, mode_changeable=True)
+    return {"mode": functions[0], "direction": "IN", "mode_changeable": True}
+
+
+def dio_input(index, pin):
+    return {"mode": "DIO", "direction": "IN", "resistor": "PULL_UP", "drive": "8MA", "slew_rate": True,
+            "interrupt": "BOTH_EDGES", "direction_changeable": True, "mode_changeable": True}
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate the configurations of the Port benchmark.")
+    parser.add_argument("cfg", help="Port_Cfg.h to derive the benchmark configuration from")
+    parser.add_argument("output", help="directory receiving Port_PBcfg.json and Port_Cfg.h")
+    parser.add_argument("--device", choices=sorted(generator.DEVICES), default="TM4C123",
+                        help="device whose pins are configured")
+    parser.add_argument("--pins-per-port", type=int, default=generator.PINS_PER_PORT, metavar="PINS",
+                        help="configure only the first PINS usable pins of every port")
+    parser.add_argument("--set", action="append", default=[], metavar="NAME=VALUE",
+                        help="override a switch of Port_Cfg.h, e.g. PORT_SHADOW_REGISTERS=STD_ON")
+    args = parser.parse_args()
+
+    generator.select_device(args.device)
+    pins = bench_pins(args.pins_per_port)
+    description = {"device": args.device, "variants": [
+        variant("Port_Configuration", pins, dio_output),
+        variant("Port_BenchPeripheral", pins, peripheral),
+        variant("Port_BenchInputs", pins, dio_input),
+    ]}
+    with open(os.path.join(args.output, "Port_PBcfg.json"), "w") as handle:
+        json.dump(description, handle, indent=4)
+
+    with open(args.cfg, newline="") as handle:
+        cfg = handle.read()
+    switches = {"PORT_DEVICE_TM4C129": generator.DEVICES[args.device]["switch"],
+                "PORT_CONFIGURED_CHANNELS": "%dU" % len(pins),
+                "PORT_CONFIGURED_PARALLEL_BUSES": "0U",
+                "PORT_AHB_PORTS_MASK": "0x00U"}
+    for setting in args.set:
+        name, _, value = setting.partition("=")
+        switches[name] = value
+    for name, value in switches.items():
+        cfg, count = re.subn(r"(#define %s\s+)\([^)]*\)" % name, r"\g<1>(%s)" % value, cfg)
+        if count != 1:
+            sys.stderr.write("Port_BenchConfig: %s not found in %s\n" % (name, args.cfg))
+            return 1
+    with open(os.path.join(args.output, "Port_Cfg.h"), "w", newline="") as handle:
+        handle.write(cfg)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
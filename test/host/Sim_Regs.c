@@ -0,0 +1,275 @@
+/******************************************************************************
+ *  @file       Sim_Regs.c
+ *  @brief      Simulated register file of the Port Driver host benchmark
+ *
+ *  @details
+ *  Port.c is compiled with -fsanitize=thread and tsan-distinguish-volatile,
+ *  which makes the compiler call __tsan_volatile_readN / __tsan_volatile_writeN
+ *  right before every volatile load and store. This file implements those
+ *  hooks instead of linking the ThreadSanitizer runtime: an access that hits
+ *  Sim_Regs is counted, and the alias registers are kept coherent with the
+ *  register they alias:
+ *  - a load from a GPIODATA alias (offset MASK << 2) returns DATA & MASK,
+ *    a store to it only changes the MASK bits of DATA,
+ *  - a load from a bit-band alias word returns the bit, a store sets or
+ *    clears it,
+ *  - a store to DMACFG sets the master enable of DMASTAT, a store to
+ *    DMAENACLR clears its channels in DMAENASET.
+ *  A store is only seen before it happens, so it is applied on the next hook
+ *  (the next volatile access or the exit of a driver function).
+ ******************************************************************************/
+
+#include <stddef.h>
+#include <string.h>
+
+#include "Std_Types.h"
+#include "Sim_Regs.h"
+
+/* Word of a GPIO page holding the unmasked GPIODATA register (offset 0x3FC) */
+#define SIM_DATA_WORD                     (PORT_DATA_REG_OFFSET >> 2U)
+
+/* Host pointers handed to the uDMA controller, handle = SIM_DMA_HANDLE | index */
+#define SIM_DMA_POINTERS                  (16U)
+#define SIM_DMA_HANDLE                    (0xD0000000U)
+
+/* Fields of a uDMA channel control word */
+#define SIM_DMA_XFERSIZE(CONTROL)         ((((CONTROL) >> 4U) & 0x3FFU) + 1U)
+#define SIM_DMA_SRCINC_NONE(CONTROL)      ((((CONTROL) >> 26U) & 0x3U) == 0x3U)
+#define SIM_DMA_DSTINC_NONE(CONTROL)      ((((CONTROL) >> 30U) & 0x3U) == 0x3U)
+
+Sim_RegsType Sim_Regs;
+
+static Sim_CountersType Sim_Counters;
+
+/* Register file word of the last store, applied by the next hook */
+static volatile uint32* Sim_Pending = NULL;
+
+static const volatile void* Sim_DmaPointers[SIM_DMA_POINTERS];
+static uint32 Sim_DmaPointerCount = 0U;
+
+static int Sim_InGpio(const void* addr)
+{
+    return ((const uint8*)addr >= (const uint8*)Sim_Regs.Gpio) &&
+           ((const uint8*)addr < (const uint8*)Sim_Regs.Gpio + sizeof(Sim_Regs.Gpio));
+}
+
+static int Sim_InBitband(const void* addr)
+{
+    return ((const uint8*)addr >= (const uint8*)Sim_Regs.Bitband) &&
+           ((const uint8*)addr < (const uint8*)Sim_Regs.Bitband + sizeof(Sim_Regs.Bitband));
+}
+
+static int Sim_InRegs(const void* addr)
+{
+    return ((const uint8*)addr >= (const uint8*)&Sim_Regs) &&
+           ((const uint8*)addr < (const uint8*)&Sim_Regs + sizeof(Sim_Regs));
+}
+
+/* Propagate the last store to a GPIODATA or bit-band alias into the aliased register */
+static void Sim_Apply(void)
+{
+    volatile uint32* cell = Sim_Pending;
+
+    if (cell == NULL)
+    {
+        return;
+    }
+    Sim_Pending = NULL;
+
+    if (Sim_InGpio((const void*)cell))
+    {
+        size_t word = (size_t)(cell - &Sim_Regs.Gpio[0][0]);
+        uint32* page = Sim_Regs.Gpio[word / SIM_GPIO_WORDS];
+        uint32 mask = (uint32)(word % SIM_GPIO_WORDS);
+
+        if (mask < SIM_DATA_WORD)
+        {
+            page[SIM_DATA_WORD] = (page[SIM_DATA_WORD] & ~mask) | (*cell & mask);
+        }
+    }
+    else if (Sim_InBitband((const void*)cell))
+    {
+        size_t bit = (size_t)(cell - &Sim_Regs.Bitband[0][0][0]);
+        size_t reg = bit / 32U;
+        uint32* target = &Sim_Regs.Gpio[reg / SIM_BITBAND_WORDS][reg % SIM_BITBAND_WORDS];
+
+        *target = (*target & ~(1U << (bit % 32U))) | ((*cell & 1U) << (bit % 32U));
+    }
+    else if (cell == &Sim_Regs.DmaCfg)
+    {
+        Sim_Regs.DmaStat = (Sim_Regs.DmaStat & ~UDMA_MASTER_ENABLE) | (*cell & UDMA_MASTER_ENABLE);
+    }
+    else if (cell == &Sim_Regs.DmaEnaClr)
+    {
+        Sim_Regs.DmaEnaSet &= ~*cell;
+    }
+}
+
+/* Load the current value of an alias word before the driver reads it */
+static void Sim_Refresh(volatile uint32* cell)
+{
+    if (Sim_InGpio((const void*)cell))
+    {
+        size_t word = (size_t)(cell - &Sim_Regs.Gpio[0][0]);
+        uint32 mask = (uint32)(word % SIM_GPIO_WORDS);
+
+        if (mask < SIM_DATA_WORD)
+        {
+            *cell = Sim_Regs.Gpio[word / SIM_GPIO_WORDS][SIM_DATA_WORD] & mask;
+        }
+    }
+    else if (Sim_InBitband((const void*)cell))
+    {
+        size_t bit = (size_t)(cell - &Sim_Regs.Bitband[0][0][0]);
+        size_t reg = bit / 32U;
+
+        *cell = (Sim_Regs.Gpio[reg / SIM_BITBAND_WORDS][reg % SIM_BITBAND_WORDS] >> (bit % 32U)) & 1U;
+    }
+}
+
+static void Sim_Read(void* addr)
+{
+    Sim_Apply();
+    if (Sim_InRegs(addr))
+    {
+        Sim_Counters.Reads++;
+        Sim_Refresh((volatile uint32*)addr);
+    }
+}
+
+static void Sim_Write(void* addr)
+{
+    Sim_Apply();
+    if (Sim_InRegs(addr))
+    {
+        Sim_Counters.Writes++;
+        Sim_Pending = (volatile uint32*)addr;
+    }
+}
+
+void Sim_Reset(void)
+{
+    memset(&Sim_Regs, 0, sizeof(Sim_Regs));
+    Sim_Pending = NULL;
+    Sim_DmaPointerCount = 0U;
+    Sim_Regs.Prgpio = 0xFFFFFFFFU;
+    Sim_Regs.Prdma = 0x1U;
+    Sim_StartCount();
+}
+
+void Sim_StartCount(void)
+{
+    Sim_Apply();
+    Sim_Counters.Reads = 0U;
+    Sim_Counters.Writes = 0U;
+}
+
+Sim_CountersType Sim_ReadCount(void)
+{
+    Sim_Apply();
+    return Sim_Counters;
+}
+
+uint32 Sim_DmaAddress(const volatile void* Pointer)
+{
+    uint32 index;
+
+    for (index = 0U; index < Sim_DmaPointerCount; index++)
+    {
+        if (Sim_DmaPointers[index] == Pointer)
+        {
+            return SIM_DMA_HANDLE | index;
+        }
+    }
+    if (Sim_DmaPointerCount == SIM_DMA_POINTERS)
+    {
+        return 0U;
+    }
+    Sim_DmaPointers[Sim_DmaPointerCount] = Pointer;
+    return SIM_DMA_HANDLE | Sim_DmaPointerCount++;
+}
+
+void* Sim_DmaPointer(uint32 Address)
+{
+    uint32 index = Address & ~SIM_DMA_HANDLE;
+
+    if (((Address & SIM_DMA_HANDLE) != SIM_DMA_HANDLE) || (index >= Sim_DmaPointerCount))
+    {
+        return NULL;
+    }
+    return (void*)(uintptr_t)Sim_DmaPointers[index];
+}
+
+uint32 Sim_RunDma(uint8 Channel)
+{
+    const uint32* control = (const uint32*)Sim_DmaPointer(Sim_Regs.DmaCtlBase);
+    uint32 channelBit = 1U << (Channel & 0x1FU);
+    const volatile uint8* src;
+    volatile uint32* dst;
+    uint32 items;
+    uint32 item;
+
+    Sim_Apply();
+    if ((control == NULL) || ((Sim_Regs.DmaStat & UDMA_MASTER_ENABLE) == 0U) ||
+        ((Sim_Regs.DmaEnaSet & channelBit) == 0U))
+    {
+        return 0U;
+    }
+
+    /* Primary structure of the channel: source end, destination end, control word */
+    control = &control[(Channel & 0x1FU) * 4U];
+    items = SIM_DMA_XFERSIZE(control[2]);
+    src = (const volatile uint8*)Sim_DmaPointer(control[0]);
+    dst = (volatile uint32*)Sim_DmaPointer(control[1]);
+    if ((src == NULL) || (dst == NULL) || SIM_DMA_SRCINC_NONE(control[2]) || !SIM_DMA_DSTINC_NONE(control[2]))
+    {
+        /* Only the byte-to-register streams of the driver are simulated */
+        return 0U;
+    }
+
+    src -= items - 1U;
+    for (item = 0U; item < items; item++)
+    {
+        *dst = src[item];
+        Sim_Pending = dst;
+        Sim_Apply();
+    }
+
+    /* The controller disables the channel at the end of the transfer */
+    Sim_Regs.DmaEnaSet &= ~channelBit;
+    return items;
+}
+
+/* ****************************************************************
+ * Compiler Instrumentation Hooks
+ * ****************************************************************/
+
+#define SIM_HOOKS(SIZE) \
+    void __tsan_volatile_read##SIZE(void* addr);  void __tsan_volatile_read##SIZE(void* addr)  { Sim_Read(addr); } \
+    void __tsan_volatile_write##SIZE(void* addr); void __tsan_volatile_write##SIZE(void* addr) { Sim_Write(addr); } \
+    void __tsan_read##SIZE(void* addr);           void __tsan_read##SIZE(void* addr)           { (void)addr; } \
+    void __tsan_write##SIZE(void* addr);          void __tsan_write##SIZE(void* addr)          { (void)addr; } \
+    void __tsan_unaligned_read##SIZE(void* addr); void __tsan_unaligned_read##SIZE(void* addr) { (void)addr; } \
+    void __tsan_unaligned_write##SIZE(void* addr); void __tsan_unaligned_write##SIZE(void* addr) { (void)addr; }
+
+SIM_HOOKS(1)
+SIM_HOOKS(2)
+SIM_HOOKS(4)
+SIM_HOOKS(8)
+SIM_HOOKS(16)
+
+void __tsan_init(void);
+void __tsan_init(void) {}
+
+void __tsan_func_entry(void* pc);
+void __tsan_func_entry(void* pc) { (void)pc; }
+
+/* A store issued by the returning function is complete once it returns */
+void __tsan_func_exit(void);
+void __tsan_func_exit(void) { Sim_Apply(); }
+
+void __tsan_read_range(void* addr, unsigned long size);
+void __tsan_read_range(void* addr, unsigned long size) { (void)addr; (void)size; }
+
+void __tsan_write_range(void* addr, unsigned long size);
+void __tsan_write_range(void* addr, unsigned long size) { (void)addr; (void)size; }
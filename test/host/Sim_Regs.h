@@ -0,0 +1,167 @@
+/******************************************************************************
+ *  @file       Sim_Regs.h
+ *  @brief      Simulated register file of the Port Driver host benchmark
+ *
+ *  @details
+ *  Substituted for Port_Regs.h through PORT_REGS_HEADER. It keeps the GPIO
+ *  offsets and bit definitions of Port_Regs.h and moves every register into
+ *  Sim_Regs, a plain array in host memory:
+ *  - each GPIO port is a 4 KB page indexed by its base address, so APB and
+ *    AHB apertures stay distinct,
+ *  - the bit-band alias of a GPIO register is one word per bit,
+ *  - the System Control, uDMA, NVIC and DWT registers are plain words,
+ *  - a host pointer handed to the uDMA controller becomes a 32-bit handle,
+ *    and Sim_RunDma performs the transfer programmed on a channel.
+ *  Sim_Regs.c observes every volatile access of the driver to this array
+ *  (compiled with -fsanitize=thread, see the Makefile), counts it as a read
+ *  or a write and keeps the GPIODATA and bit-band aliases coherent.
+ ******************************************************************************/
+#ifndef SIM_REGS_H_
+#define SIM_REGS_H_
+
+#include <stdint.h>
+
+#include "Port_Regs.h"
+
+/* ****************************************************************
+ * Register File
+ * ****************************************************************/
+
+/* Pages of the GPIO apertures (0x40000000 + page * 0x1000) */
+#define SIM_GPIO_PAGES                    (0x80U)
+
+/* Words of a GPIO page, and words covered by the bit-band alias (up to GPIOPCTL) */
+#define SIM_GPIO_WORDS                    (0x400U)
+#define SIM_BITBAND_WORDS                 ((PORT_CTL_REG_OFFSET >> 2U) + 1U)
+
+typedef struct
+{
+    uint32 Gpio[SIM_GPIO_PAGES][SIM_GPIO_WORDS];
+    uint32 Bitband[SIM_GPIO_PAGES][SIM_BITBAND_WORDS][32];
+    uint32 Rcgcgpio;
+    uint32 Scgcgpio;
+    uint32 Dcgcgpio;
+    uint32 Rcgcdma;
+    uint32 Prdma;
+    uint32 Prgpio;
+    uint32 Gpiohbctl;
+    uint32 DmaStat;
+    uint32 DmaCfg;
+    uint32 DmaCtlBase;
+    uint32 DmaUseBurstClr;
+    uint32 DmaReqMaskClr;
+    uint32 DmaEnaSet;
+    uint32 DmaEnaClr;
+    uint32 DmaAltClr;
+    uint32 DmaPrioClr;
+    uint32 DmaChMap[4];
+    uint32 NvicEn[4];
+    uint32 Demcr;
+    uint32 DwtCtrl;
+    uint32 DwtCyccnt;
+} Sim_RegsType;
+
+extern Sim_RegsType Sim_Regs;
+
+/* Page of a GPIO base address, whether it is an integer or a pointer */
+#define SIM_GPIO_PAGE(BASE)               ((((uint32)(uintptr_t)(BASE)) >> 12U) & (SIM_GPIO_PAGES - 1U))
+
+#define PORT_REG(BASE, OFFSET) \
+    (*(volatile uint32*)&Sim_Regs.Gpio[SIM_GPIO_PAGE(BASE)][((uint32)(OFFSET) & 0xFFFU) >> 2U])
+
+#define PORT_BITBAND_REG(BASE, OFFSET, BIT) \
+    (*(volatile uint32*)&Sim_Regs.Bitband[SIM_GPIO_PAGE(BASE)][((uint32)(OFFSET) & 0xFFFU) >> 2U][(BIT)])
+
+/* ****************************************************************
+ * System Registers
+ * ****************************************************************/
+
+#undef  SYSCTL_RCGCGPIO_REG
+#undef  SYSCTL_SCGCGPIO_REG
+#undef  SYSCTL_DCGCGPIO_REG
+#undef  SYSCTL_RCGCDMA_REG
+#undef  SYSCTL_PRDMA_REG
+#undef  SYSCTL_PRGPIO_REG
+#undef  SYSCTL_GPIOHBCTL_REG
+#undef  UDMA_STAT_REG
+#undef  UDMA_CFG_REG
+#undef  UDMA_CTLBASE_REG
+#undef  UDMA_USEBURSTCLR_REG
+#undef  UDMA_REQMASKCLR_REG
+#undef  UDMA_ENASET_REG
+#undef  UDMA_ENACLR_REG
+#undef  UDMA_ALTCLR_REG
+#undef  UDMA_PRIOCLR_REG
+#undef  UDMA_CHMAP_REG
+#undef  NVIC_EN0_REG
+#undef  NVIC_EN_REG
+#undef  CORE_DEMCR_REG
+#undef  DWT_CTRL_REG
+#undef  DWT_CYCCNT_REG
+
+#define SYSCTL_RCGCGPIO_REG               (*(volatile uint32*)&Sim_Regs.Rcgcgpio)
+#define SYSCTL_SCGCGPIO_REG               (*(volatile uint32*)&Sim_Regs.Scgcgpio)
+#define SYSCTL_DCGCGPIO_REG               (*(volatile uint32*)&Sim_Regs.Dcgcgpio)
+#define SYSCTL_RCGCDMA_REG                (*(volatile uint32*)&Sim_Regs.Rcgcdma)
+#define SYSCTL_PRDMA_REG                  (*(volatile uint32*)&Sim_Regs.Prdma)
+#define SYSCTL_PRGPIO_REG                 (*(volatile uint32*)&Sim_Regs.Prgpio)
+#define SYSCTL_GPIOHBCTL_REG              (*(volatile uint32*)&Sim_Regs.Gpiohbctl)
+#define UDMA_STAT_REG                     (*(volatile uint32*)&Sim_Regs.DmaStat)
+#define UDMA_CFG_REG                      (*(volatile uint32*)&Sim_Regs.DmaCfg)
+#define UDMA_CTLBASE_REG                  (*(volatile uint32*)&Sim_Regs.DmaCtlBase)
+#define UDMA_USEBURSTCLR_REG              (*(volatile uint32*)&Sim_Regs.DmaUseBurstClr)
+#define UDMA_REQMASKCLR_REG               (*(volatile uint32*)&Sim_Regs.DmaReqMaskClr)
+#define UDMA_ENASET_REG                   (*(volatile uint32*)&Sim_Regs.DmaEnaSet)
+#define UDMA_ENACLR_REG                   (*(volatile uint32*)&Sim_Regs.DmaEnaClr)
+#define UDMA_ALTCLR_REG                   (*(volatile uint32*)&Sim_Regs.DmaAltClr)
+#define UDMA_PRIOCLR_REG                  (*(volatile uint32*)&Sim_Regs.DmaPrioClr)
+#define UDMA_CHMAP_REG(N)                 (*(volatile uint32*)&Sim_Regs.DmaChMap[(N) & 3U])
+#define NVIC_EN0_REG                      (*(volatile uint32*)&Sim_Regs.NvicEn[0])
+#define NVIC_EN_REG(N)                    (*(volatile uint32*)&Sim_Regs.NvicEn[(N) & 3U])
+#define CORE_DEMCR_REG                    (*(volatile uint32*)&Sim_Regs.Demcr)
+#define DWT_CTRL_REG                      (*(volatile uint32*)&Sim_Regs.DwtCtrl)
+#define DWT_CYCCNT_REG                    (*(volatile uint32*)&Sim_Regs.DwtCyccnt)
+
+/* ****************************************************************
+ * uDMA Addresses
+ * ****************************************************************/
+
+#undef  PORT_DMA_ADDRESS
+#undef  PORT_DMA_POINTER
+
+/* A host pointer does not fit a 32-bit uDMA register, it is stored as a handle */
+#define PORT_DMA_ADDRESS(PTR)             Sim_DmaAddress((const volatile void*)(PTR))
+#define PORT_DMA_POINTER(ADDR)            Sim_DmaPointer(ADDR)
+
+/* Handle of a host pointer, the same handle for the same pointer */
+uint32 Sim_DmaAddress(const volatile void* Pointer);
+
+/* Host pointer of a handle, NULL for an unknown handle */
+void* Sim_DmaPointer(uint32 Address);
+
+/*
+ * Perform the whole basic transfer programmed on an enabled channel, as its
+ * requests would, and disable the channel. Returns the number of items moved.
+ */
+uint32 Sim_RunDma(uint8 Channel);
+
+/* ****************************************************************
+ * Access Counters
+ * ****************************************************************/
+
+typedef struct
+{
+    uint32 Reads;                   /* Volatile loads from the register file */
+    uint32 Writes;                  /* Volatile stores to the register file */
+} Sim_CountersType;
+
+/* Power-on state: all the registers cleared, every port ready in PRGPIO */
+void Sim_Reset(void);
+
+/* Start counting from zero */
+void Sim_StartCount(void);
+
+/* Accesses since the last Sim_StartCount */
+Sim_CountersType Sim_ReadCount(void);
+
+#endif /* SIM_REGS_H_ */
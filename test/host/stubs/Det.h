@@ -0,0 +1,18 @@
+/******************************************************************************
+ *  @file       Det.h
+ *  @brief      Host stub of the Default Error Tracer for the Port benchmark
+ ******************************************************************************/
+#ifndef DET_H
+#define DET_H
+
+#include "Std_Types.h"
+
+/* AUTOSAR Version 4.0.3 */
+#define DET_AR_MAJOR_VERSION    (4U)
+#define DET_AR_MINOR_VERSION    (0U)
+#define DET_AR_PATCH_VERSION    (3U)
+
+/* Implemented by the benchmark, which fails on any reported error */
+Std_ReturnType Det_ReportError(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId);
+
+#endif /* DET_H */
@@ -0,0 +1,11 @@
+/******************************************************************************
+ *  @file       Dio.h
+ *  @brief      Host stub of the Dio Driver header for the Port benchmark
+ ******************************************************************************/
+#ifndef DIO_H
+#define DIO_H
+
+#include "Std_Types.h"
+#include "Dio_Cfg.h"
+
+#endif /* DIO_H */
@@ -0,0 +1,16 @@
+/******************************************************************************
+ *  @file       Dio_Cfg.h
+ *  @brief      Host stub of the Dio configuration for the Port benchmark
+ *
+ *  @details    The synthetic configurations name no Dio channel; the LED1 and
+ *              SW1 symbols keep the default Port_PBcfg.c buildable.
+ ******************************************************************************/
+#ifndef DIO_CFG_H
+#define DIO_CFG_H
+
+#define DioConf_LED1_PORT_NUM               (5U)
+#define DioConf_LED1_CHANNEL_NUM            (1U)
+#define DioConf_SW1_PORT_NUM                (5U)
+#define DioConf_SW1_CHANNEL_NUM             (4U)
+
+#endif /* DIO_CFG_H */
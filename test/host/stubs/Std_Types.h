@@ -0,0 +1,52 @@
+/******************************************************************************
+ *  @file       Std_Types.h
+ *  @brief      Host stub of the AUTOSAR standard types for the Port benchmark
+ ******************************************************************************/
+#ifndef STD_TYPES_H
+#define STD_TYPES_H
+
+/* AUTOSAR Version 4.0.3 */
+#define STD_TYPES_AR_RELEASE_MAJOR_VERSION  (4U)
+#define STD_TYPES_AR_RELEASE_MINOR_VERSION  (0U)
+#define STD_TYPES_AR_RELEASE_PATCH_VERSION  (3U)
+
+typedef unsigned char         boolean;
+typedef unsigned char         uint8;
+typedef signed char           sint8;
+typedef unsigned short        uint16;
+typedef signed short          sint16;
+typedef unsigned int          uint32;
+typedef signed int            sint32;
+typedef unsigned long long    uint64;
+typedef signed long long      sint64;
+
+typedef uint8 Std_ReturnType;
+
+typedef struct
+{
+    uint16 vendorID;
+    uint16 moduleID;
+    uint8  sw_major_version;
+    uint8  sw_minor_version;
+    uint8  sw_patch_version;
+} Std_VersionInfoType;
+
+#define E_OK            ((Std_ReturnType)0x00U)
+#define E_NOT_OK        ((Std_ReturnType)0x01U)
+
+#define STD_HIGH        (0x01U)
+#define STD_LOW         (0x00U)
+
+#define STD_ON          (0x01U)
+#define STD_OFF         (0x00U)
+
+#ifndef TRUE
+#define TRUE            (1U)
+#endif
+#ifndef FALSE
+#define FALSE           (0U)
+#endif
+
+#define NULL_PTR        ((void*)0)
+
+#endif /* STD_TYPES_H */
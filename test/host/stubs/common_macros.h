@@ -0,0 +1,14 @@
+/******************************************************************************
+ *  @file       common_macros.h
+ *  @brief      Host stub of the common bit macros for the Port benchmark
+ ******************************************************************************/
+#ifndef COMMON_MACROS
+#define COMMON_MACROS
+
+#define SET_BIT(REG, BIT)       ((REG) |= (1U << (BIT)))
+#define CLEAR_BIT(REG, BIT)     ((REG) &= ~(1U << (BIT)))
+#define TOGGLE_BIT(REG, BIT)    ((REG) ^= (1U << (BIT)))
+#define BIT_IS_SET(REG, BIT)    ((REG) & (1U << (BIT)))
+#define BIT_IS_CLEAR(REG, BIT)  (!((REG) & (1U << (BIT))))
+
+#endif /* COMMON_MACROS */
@@ -0,0 +1,623 @@
+#!/usr/bin/env python3
+"""
+Port_Generator.py - Post-build configuration generator of the Port Driver.
+
+Reads the pin description of every configuration variant (Port_PBcfg.json),
+rejects conflicting or unsupported pin assignments and generates
+Port_PBcfg.c: the channel table used by the runtime APIs together with the
+per-port register image that Port_Init applies as is.
+
+The target device is the "device" key of the description (TM4C123 when
+absent), or --device; it must match PORT_DEVICE_TM4C129 of Port_Cfg.h.
+
+Usage:
+    python3 tools/Port_Generator.py [Port_PBcfg.json] [-o Port_PBcfg.c]
+    python3 tools/Port_Generator.py --check    (fails if Port_PBcfg.c is stale)
+    python3 tools/Port_Generator.py --device TM4C129 large.json -o large.c
+"""
+
+import argparse
+import json
+import os
+import sys
+
+# ****************************************************************
+# Hardware description (TM4C123GH6PM)
+# ****************************************************************
+
+PORTS = "ABCDEF"
+PINS_PER_PORT = 8
+
+# Pins protected by GPIOLOCK/GPIOCR that the generator can commit
+LOCKED_PINS = {("D", 7), ("F", 0)}
+
+# JTAG/SWD pins: keep them out of the configuration or the debugger is lost
+JTAG_PINS = {("C", 0), ("C", 1), ("C", 2), ("C", 3)}
+
+# Supported modes: C macro and the DEN/AFSEL/AMSEL bit they need
+# (must match Port_ModeAttributes in Port.c)
+MODES = {
+    "DIO":   {"macro": "PIN_MODE_DIO",   "den": 1, "afsel": 0, "amsel": 0},
+    "UART":  {"macro": "PIN_MODE_UART",  "den": 1, "afsel": 1, "amsel": 0},
+    "SSI":   {"macro": "PIN_MODE_SSI",   "den": 1, "afsel": 1, "amsel": 0},
+    "I2C":   {"macro": "PIN_MODE_I2C",   "den": 1, "afsel": 1, "amsel": 0},
+    "M0PWM": {"macro": "PIN_MODE_M0PWM", "den": 1, "afsel": 1, "amsel": 0},
+    "M1PWM": {"macro": "PIN_MODE_M1PWM", "den": 1, "afsel": 1, "amsel": 0},
+    "CAN":   {"macro": "PIN_MODE_CAN",   "den": 1, "afsel": 1, "amsel": 0},
+    "QEI":   {"macro": "PIN_MODE_QEI",   "den": 1, "afsel": 1, "amsel": 0},
+    "ADC":   {"macro": "PIN_MODE_ADC",   "den": 0, "afsel": 1, "amsel": 1},
+}
+
+# Alternate functions of every bonded pin: mode -> PCTL value, None for the
+# analog ADC input (must match Port_PinModes in Port.c). DIO is always there.
+PIN_FUNCTIONS = {
+    "PA0": {"UART": 1, "CAN": 8},
+    "PA1": {"UART": 1, "CAN": 8},
+    "PA2": {"SSI": 2},
+    "PA3": {"SSI": 2},
+    "PA4": {"SSI": 2},
+    "PA5": {"SSI": 2},
+    "PA6": {"I2C": 3, "M1PWM": 5},
+    "PA7": {"I2C": 3, "M1PWM": 5},
+    "PB0": {"UART": 1},
+    "PB1": {"UART": 1},
+    "PB2": {"I2C": 3},
+    "PB3": {"I2C": 3},
+    "PB4": {"ADC": None, "SSI": 2, "M0PWM": 4, "CAN": 8},
+    "PB5": {"ADC": None, "SSI": 2, "M0PWM": 4, "CAN": 8},
+    "PB6": {"SSI": 2, "M0PWM": 4},
+    "PB7": {"SSI": 2, "M0PWM": 4},
+    "PC0": {}, "PC1": {}, "PC2": {}, "PC3": {},
+    "PC4": {"UART": 1, "M0PWM": 4, "QEI": 6},
+    "PC5": {"UART": 1, "M0PWM": 4, "QEI": 6},
+    "PC6": {"UART": 1, "QEI": 6},
+    "PC7": {"UART": 1},
+    "PD0": {"ADC": None, "SSI": 1, "I2C": 3, "M0PWM": 4, "M1PWM": 5},
+    "PD1": {"ADC": None, "SSI": 1, "I2C": 3, "M0PWM": 4, "M1PWM": 5},
+    "PD2": {"ADC": None, "SSI": 1, "M0PWM": 4},
+    "PD3": {"ADC": None, "SSI": 1, "QEI": 6},
+    "PD4": {"UART": 1},
+    "PD5": {"UART": 1},
+    "PD6": {"UART": 1, "M0PWM": 4, "QEI": 6},
+    "PD7": {"UART": 1, "QEI": 6},
+    "PE0": {"ADC": None, "UART": 1},
+    "PE1": {"ADC": None, "UART": 1},
+    "PE2": {"ADC": None},
+    "PE3": {"ADC": None},
+    "PE4": {"ADC": None, "UART": 1, "I2C": 3, "M0PWM": 4, "M1PWM": 5, "CAN": 8},
+    "PE5": {"ADC": None, "UART": 1, "I2C": 3, "M0PWM": 4, "M1PWM": 5, "CAN": 8},
+    "PF0": {"UART": 1, "SSI": 2, "CAN": 3, "M1PWM": 5, "QEI": 6},
+    "PF1": {"UART": 1, "SSI": 2, "M1PWM": 5, "QEI": 6},
+    "PF2": {"SSI": 2, "M0PWM": 4, "M1PWM": 5},
+    "PF3": {"SSI": 2, "CAN": 3, "M1PWM": 5},
+    "PF4": {"M1PWM": 5, "QEI": 6},
+}
+
+# Pins whose I2C function (SDA) needs an open-drain output
+OPEN_DRAIN_I2C_PINS = {"PA7", "PB3", "PD1", "PE5"}
+
+BUSES = {"APB": "PORT_BUS_APB", "AHB": "PORT_BUS_AHB"}
+
+# TM4C1294NCPDT: bonded pins of ports A..Q. Only DIO and the ADC inputs are
+# described (must match Port_PinModes in Port.c for PORT_DEVICE_TM4C129).
+TM4C129_BONDED = {"A": 8, "B": 6, "C": 8, "D": 8, "E": 6, "F": 5, "G": 2, "H": 4,
+                  "J": 2, "K": 8, "L": 8, "M": 8, "N": 6, "P": 6, "Q": 5}
+TM4C129_ADC_PINS = {"PB4", "PB5", "PD0", "PD1", "PD2", "PD3", "PD4", "PD5", "PD6", "PD7",
+                    "PE0", "PE1", "PE2", "PE3", "PE4", "PE5", "PK0", "PK1", "PK2", "PK3"}
+
+# Hardware description of every supported device, selected by select_device()
+DEVICES = {
+    "TM4C123": {
+        "ports": PORTS,
+        "locked_pins": LOCKED_PINS,
+        "jtag_pins": JTAG_PINS,
+        "pin_functions": PIN_FUNCTIONS,
+        "open_drain_i2c_pins": OPEN_DRAIN_I2C_PINS,
+        "buses": BUSES,
+        "switch": "STD_OFF",
+    },
+    "TM4C129": {
+        "ports": "ABCDEFGHJKLMNPQ",
+        "locked_pins": {("D", 7)},
+        "jtag_pins": JTAG_PINS,
+        "pin_functions": dict(("P%s%d" % (port, channel),
+                               {"ADC": None} if "P%s%d" % (port, channel) in TM4C129_ADC_PINS else {})
+                              for port, count in TM4C129_BONDED.items() for channel in range(count)),
+        "open_drain_i2c_pins": set(),
+        "buses": {"AHB": "PORT_BUS_AHB"},
+        "switch": "STD_ON",
+    },
+}
+DEVICE = "TM4C123"
+DIRECTIONS = {"IN": "PORT_PIN_IN", "OUT": "PORT_PIN_OUT"}
+LEVELS = {"LOW": "STD_LOW", "HIGH": "STD_HIGH"}
+RESISTORS = {"OFF": "RESISTOR_OFF", "PULL_UP": "PULL_UP", "PULL_DOWN": "PULL_DOWN"}
+DRIVES = {"2MA": "PORT_PIN_DRIVE_2MA", "4MA": "PORT_PIN_DRIVE_4MA", "8MA": "PORT_PIN_DRIVE_8MA"}
+DRIVE_FIELDS = {"2MA": "Drive2", "4MA": "Drive4", "8MA": "Drive8"}
+
+# Interrupt triggers: C macro and the GPIOIS/IBE/IEV bits they need
+INTERRUPTS = {
+    "NONE":         {"macro": "PORT_PIN_INTERRUPT_NONE",         "is": 0, "ibe": 0, "iev": 0},
+    "RISING_EDGE":  {"macro": "PORT_PIN_INTERRUPT_RISING_EDGE",  "is": 0, "ibe": 0, "iev": 1},
+    "FALLING_EDGE": {"macro": "PORT_PIN_INTERRUPT_FALLING_EDGE", "is": 0, "ibe": 0, "iev": 0},
+    "BOTH_EDGES":   {"macro": "PORT_PIN_INTERRUPT_BOTH_EDGES",   "is": 0, "ibe": 1, "iev": 0},
+    "LOW_LEVEL":    {"macro": "PORT_PIN_INTERRUPT_LOW_LEVEL",    "is": 1, "ibe": 0, "iev": 0},
+    "HIGH_LEVEL":   {"macro": "PORT_PIN_INTERRUPT_HIGH_LEVEL",   "is": 1, "ibe": 0, "iev": 1},
+}
+
+# Members of Port_PortImageType, in declaration order, with their C width
+IMAGE_FIELDS = [
+    ("PinMask", 8), ("CommitMask", 8), ("Dir", 8), ("FixedDirMask", 8),
+    ("FixedModeMask", 8), ("DataMask", 8), ("Data", 8), ("ResistorMask", 8), ("PullUp", 8),
+    ("PullDown", 8), ("ModeMask", 8), ("DigitalEnable", 8), ("AltFunc", 8),
+    ("AnalogMode", 8), ("OpenDrain", 8), ("OpenDrainPins", 8), ("Drive2", 8), ("Drive4", 8),
+    ("Drive8", 8), ("SlewRate", 8), ("InterruptMask", 8), ("InterruptSense", 8),
+    ("InterruptBothEdges", 8), ("InterruptEvent", 8), ("CtlMask", 32), ("Ctl", 32),
+]
+
+
+class ConfigError(Exception):
+    """A pin description that cannot be turned into a valid configuration."""
+
+
+def select_device(name):
+    """Makes the hardware description of device NAME the current one."""
+    global DEVICE, PORTS, LOCKED_PINS, JTAG_PINS, PIN_FUNCTIONS, OPEN_DRAIN_I2C_PINS, BUSES
+    device = lookup(DEVICES, name, "device", "description")
+    DEVICE = name
+    PORTS = device["ports"]
+    LOCKED_PINS = device["locked_pins"]
+    JTAG_PINS = device["jtag_pins"]
+    PIN_FUNCTIONS = device["pin_functions"]
+    OPEN_DRAIN_I2C_PINS = device["open_drain_i2c_pins"]
+    BUSES = device["buses"]
+
+
+def lookup(table, value, what, where):
+    if value not in table:
+        raise ConfigError("%s: unsupported %s '%s' (expected one of %s)"
+                          % (where, what, value, ", ".join(sorted(table))))
+    return table[value]
+
+
+# ****************************************************************
+# Validation and register image computation
+# ****************************************************************
+
+def parse_pin(pin, index, variant):
+    where = "%s: pin #%d (%s)" % (variant, index, pin.get("name", "unnamed"))
+    port = pin.get("port")
+    if port not in PORTS or len(port) != 1:
+        raise ConfigError("%s: invalid port '%s'" % (where, port))
+    channel = pin.get("channel")
+    if not isinstance(channel, int) or not 0 <= channel < PINS_PER_PORT:
+        raise ConfigError("%s: invalid channel '%s'" % (where, channel))
+    if (port, channel) in JTAG_PINS:
+        raise ConfigError("%s: P%s%d is a JTAG pin" % (where, port, channel))
+    if "P%s%d" % (port, channel) not in PIN_FUNCTIONS:
+        raise ConfigError("%s: P%s%d is not bonded on this device" % (where, port, channel))
+
+    parsed = {
+        "name": pin.get("name", "P%s%d" % (port, channel)),
+        "dio": pin.get("dio"),
+        "port": PORTS.index(port),
+        "channel": channel,
+        "mode": pin.get("mode", "DIO"),
+        "direction": pin.get("direction", "IN"),
+        "level": pin.get("level", "LOW"),
+        "direction_changeable": bool(pin.get("direction_changeable", False)),
+        "mode_changeable": bool(pin.get("mode_changeable", False)),
+        "resistor": pin.get("resistor", "OFF"),
+        "drive": pin.get("drive", "2MA"),
+        "slew_rate": bool(pin.get("slew_rate", False)),
+        "open_drain": bool(pin.get("open_drain", False)),
+        "interrupt": pin.get("interrupt", "NONE"),
+    }
+    lookup(MODES, parsed["mode"], "mode", where)
+    if parsed["mode"] != "DIO" and parsed["mode"] not in PIN_FUNCTIONS["P%s%d" % (port, channel)]:
+        raise ConfigError("%s: mode %s is not available on P%s%d"
+                          % (where, parsed["mode"], port, channel))
+    lookup(DIRECTIONS, parsed["direction"], "direction", where)
+    lookup(LEVELS, parsed["level"], "level", where)
+    lookup(RESISTORS, parsed["resistor"], "resistor", where)
+    if parsed["direction"] == "OUT" and parsed["resistor"] != "OFF":
+        raise ConfigError("%s: internal resistor configured on an output pin" % where)
+    lookup(DRIVES, parsed["drive"], "drive", where)
+    if parsed["slew_rate"] and parsed["drive"] != "8MA":
+        raise ConfigError("%s: slew rate control needs the 8MA drive" % where)
+    lookup(INTERRUPTS, parsed["interrupt"], "interrupt", where)
+    if parsed["interrupt"] != "NONE" and (parsed["direction"] != "IN" or not MODES[parsed["mode"]]["den"]):
+        raise ConfigError("%s: interrupt configured on a pin that is not a digital input" % where)
+    return parsed
+
+
+def empty_image():
+    return dict((name, 0) for name, _ in IMAGE_FIELDS)
+
+
+def build_images(pins):
+    images = [empty_image() for _ in PORTS]
+    for pin in pins:
+        image = images[pin["port"]]
+        bit = 1 << pin["channel"]
+        mode = MODES[pin["mode"]]
+
+        image["PinMask"] |= bit
+        if (PORTS[pin["port"]], pin["channel"]) in LOCKED_PINS:
+            image["CommitMask"] |= bit
+        if not pin["direction_changeable"]:
+            image["FixedDirMask"] |= bit
+        if not pin["mode_changeable"]:
+            image["FixedModeMask"] |= bit
+
+        if pin["direction"] == "OUT":
+            image["Dir"] |= bit
+            image["DataMask"] |= bit
+            if pin["level"] == "HIGH":
+                image["Data"] |= bit
+        elif pin["resistor"] != "OFF":
+            image["ResistorMask"] |= bit
+            image["PullUp" if pin["resistor"] == "PULL_UP" else "PullDown"] |= bit
+
+        name = "P%s%d" % (PORTS[pin["port"]], pin["channel"])
+        ctl = PIN_FUNCTIONS[name].get(pin["mode"]) or 0
+        image["ModeMask"] |= bit
+        image["DigitalEnable"] |= bit if mode["den"] else 0
+        image["AltFunc"] |= bit if mode["afsel"] else 0
+        image["AnalogMode"] |= bit if mode["amsel"] else 0
+        if pin["mode"] == "I2C" and name in OPEN_DRAIN_I2C_PINS:
+            image["OpenDrain"] |= bit
+        if pin["open_drain"]:
+            image["OpenDrain"] |= bit
+            image["OpenDrainPins"] |= bit
+        image[DRIVE_FIELDS[pin["drive"]]] |= bit
+        if pin["slew_rate"]:
+            image["SlewRate"] |= bit
+        if pin["interrupt"] != "NONE":
+            trigger = INTERRUPTS[pin["interrupt"]]
+            image["InterruptMask"] |= bit
+            image["InterruptSense"] |= bit if trigger["is"] else 0
+            image["InterruptBothEdges"] |= bit if trigger["ibe"] else 0
+            image["InterruptEvent"] |= bit if trigger["iev"] else 0
+        image["CtlMask"] |= 0xF << (pin["channel"] * 4)
+        image["Ctl"] |= ctl << (pin["channel"] * 4)
+    return images
+
+
+def parse_variant(variant, channels):
+    name = variant.get("name")
+    if not name or not name.isidentifier():
+        raise ConfigError("invalid variant name '%s'" % name)
+
+    ports = variant.get("ports", {})
+    for port in ports:
+        if port not in PORTS or len(port) != 1:
+            raise ConfigError("%s: invalid port '%s'" % (name, port))
+    default_bus = "APB" if "APB" in BUSES else "AHB"
+    buses = [lookup(BUSES, ports.get(port, {}).get("bus", default_bus), "bus",
+                    "%s: PORT%s" % (name, port)) for port in PORTS]
+    sleep = [bool(ports.get(port, {}).get("sleep_clock", False)) for port in PORTS]
+    deep_sleep = [bool(ports.get(port, {}).get("deep_sleep_clock", False)) for port in PORTS]
+
+    pins = [parse_pin(pin, index, name) for index, pin in enumerate(variant.get("pins", []))]
+    if channels is not None and len(pins) != channels:
+        raise ConfigError("%s: %d pins configured, other variants have %d"
+                          % (name, len(pins), channels))
+
+    owners = {}
+    for pin in pins:
+        key = (pin["port"], pin["channel"])
+        if key in owners:
+            raise ConfigError("%s: P%s%d assigned to both %s and %s"
+                              % (name, PORTS[key[0]], key[1], owners[key], pin["name"]))
+        owners[key] = pin["name"]
+
+    images = build_images(pins)
+    for port in range(len(PORTS)):
+        if (sleep[port] or deep_sleep[port]) and images[port]["PinMask"] == 0:
+            raise ConfigError("%s: PORT%s has a sleep clock but no configured pin" % (name, PORTS[port]))
+
+    parallel = [parse_parallel_bus(bus, index, name, owners, pins)
+                for index, bus in enumerate(variant.get("parallel_buses", []))]
+
+    return {"name": name, "buses": buses, "sleep": sleep, "deep_sleep": deep_sleep,
+            "pins": pins, "images": images, "parallel_buses": parallel}
+
+
+def parse_parallel_bus(bus, index, variant, owners, pins):
+    where = "%s: parallel bus #%d (%s)" % (variant, index, bus.get("name", "unnamed"))
+    port = bus.get("port")
+    if port not in PORTS or len(port) != 1:
+        raise ConfigError("%s: invalid port '%s'" % (where, port))
+    channels = bus.get("channels")
+    if (not isinstance(channels, list) or not channels or
+            not all(isinstance(channel, int) and 0 <= channel < PINS_PER_PORT for channel in channels)):
+        raise ConfigError("%s: invalid channels '%s'" % (where, channels))
+    if len(set(channels)) != len(channels):
+        raise ConfigError("%s: channel listed twice" % where)
+    modes = dict(((pin["port"], pin["channel"]), pin["mode"]) for pin in pins)
+    for channel in channels:
+        key = (PORTS.index(port), channel)
+        if key not in owners:
+            raise ConfigError("%s: P%s%d is not a configured pin" % (where, port, channel))
+        if modes[key] != "DIO":
+            raise ConfigError("%s: P%s%d (%s) is not configured in DIO mode"
+                              % (where, port, channel, owners[key]))
+    return {
+        "name": bus.get("name", "BUS%d" % index),
+        "port": PORTS.index(port),
+        "mask": sum(1 << channel for channel in channels),
+        "shift": min(channels),
+    }
+
+
+def parse_description(description, device=None):
+    select_device(device or description.get("device", "TM4C123"))
+    variants = []
+    channels = None
+    for variant in description.get("variants", []):
+        parsed = parse_variant(variant, channels)
+        channels = len(parsed["pins"])
+        variants.append(parsed)
+    if not variants:
+        raise ConfigError("no configuration variant described")
+    for variant in variants:
+        if len(variant["parallel_buses"]) != len(variants[0]["parallel_buses"]):
+            raise ConfigError("%s: %d parallel buses configured, other variants have %d"
+                              % (variant["name"], len(variant["parallel_buses"]),
+                                 len(variants[0]["parallel_buses"])))
+    if variants[0]["name"] != "Port_Configuration":
+        raise ConfigError("the first variant must be Port_Configuration")
+    return variants
+
+
+# ****************************************************************
+# Code generation
+# ****************************************************************
+
+HEADER = """\
+/******************************************************************************
+ *  @file       Port_PBcfg.c
+ *  @author     Hassan Darwish
+ *  @date       Feb 2025
+ *  @brief      the Post Build configuration for Port Driver of TIVA-C Cortex M4
+ *
+ *  @details
+ *  This source file contains the Post Build configurations and Module verison
+ *  for the Port Driver for the AUTOSAR MCAL layer.
+ *
+ *  @warning    Generated by tools/Port_Generator.py from Port_PBcfg.json,
+ *              do not edit by hand.
+ ******************************************************************************/
+
+/* ****************************************************************************
+ *  INCLUDES
+ * ****************************************************************************/
+
+#include "Std_Types.h"
+#include "Dio.h"
+#include "Port.h"
+#include "Port_Cfg.h"
+
+
+
+/* ****************************************************************
+ * Version
+ * ****************************************************************/
+
+/*
+ * Module Version 1.0.0
+ */
+#define PORT_PBCFG_SW_MAJOR_VERSION                     (1U)
+#define PORT_PBCFG_SW_MINOR_VERSION                     (0U)
+#define PORT_PBCFG_SW_PATCH_VERSION                     (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define PORT_PBCFG_AR_RELEASE_MAJOR_VERSION             (4U)
+#define PORT_PBCFG_AR_RELEASE_MINOR_VERSION             (0U)
+#define PORT_PBCFG_AR_RELEASE_PATCH_VERSION             (3U)
+
+/* ****************************************************************
+ * Compatibilities
+ * ****************************************************************/
+
+/* AUTOSAR Version checking between PORT_PBcfg.c and PORT.h files */
+#if ((PORT_PBCFG_AR_RELEASE_MAJOR_VERSION != PORT_AR_RELEASE_MAJOR_VERSION)\\
+ ||  (PORT_PBCFG_AR_RELEASE_MINOR_VERSION != PORT_AR_RELEASE_MINOR_VERSION)\\
+ ||  (PORT_PBCFG_AR_RELEASE_PATCH_VERSION != PORT_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of PBcfg.c does not match the expected version"
+#endif
+
+/* Software Version checking between PORT_PBcfg.c and PORT.h files */
+#if ((PORT_PBCFG_SW_MAJOR_VERSION != PORT_SW_MAJOR_VERSION)\\
+ ||  (PORT_PBCFG_SW_MINOR_VERSION != PORT_SW_MINOR_VERSION)\\
+ ||  (PORT_PBCFG_SW_PATCH_VERSION != PORT_SW_PATCH_VERSION))
+  #error "The SW version of PBcfg.c does not match the expected version"
+#endif
+"""
+
+
+def emit_checks(variants):
+    lines = [
+        "",
+        "/* ****************************************************************",
+        " * Generation Checks",
+        " * ****************************************************************/",
+        "",
+        "/* The channel count of Port_Cfg.h must match the generated channel table */",
+        "#if (PORT_CONFIGURED_CHANNELS != %dU)" % len(variants[0]["pins"]),
+        "  #error \"PORT_CONFIGURED_CHANNELS does not match Port_PBcfg.json\"",
+        "#endif",
+        "",
+        "/* The parallel bus count of Port_Cfg.h must match the generated bus table */",
+        "#if (PORT_CONFIGURED_PARALLEL_BUSES != %dU)" % len(variants[0]["parallel_buses"]),
+        "  #error \"PORT_CONFIGURED_PARALLEL_BUSES does not match Port_PBcfg.json\"",
+        "#endif",
+        "",
+        "/* Port_Cfg.h must select the device the pins were checked against */",
+        "#if (PORT_DEVICE_TM4C129 != %s)" % DEVICES[DEVICE]["switch"],
+        "  #error \"PORT_DEVICE_TM4C129 does not match the %s device of Port_PBcfg.json\"" % DEVICE,
+        "#endif",
+        "",
+        "/* The generator and the mode table of Port.c must describe the same modes */",
+        "#if (PORT_NUMBER_OF_MODES != %dU)" % len(MODES),
+        "  #error \"PORT_NUMBER_OF_MODES does not match the modes known to the generator\"",
+        "#endif",
+        "",
+        "/* Build fails on an array of negative size if COND does not hold */",
+        "#define PORT_PBCFG_STATIC_ASSERT(COND, NAME)   typedef char NAME[(COND) ? 1 : -1]",
+    ]
+    ahb_masks = {sum(1 << port for port, bus in enumerate(variant["buses"]) if bus == BUSES["AHB"])
+                 for variant in variants}
+    if len(ahb_masks) != 1:
+        raise ConfigError("all variants must place the same ports on the AHB aperture")
+    if "APB" in BUSES:
+        # Without an APB aperture Port_Inline.h does not use PORT_AHB_PORTS_MASK
+        lines += [
+            "",
+            "/* Port_Inline.h resolves the base addresses on the apertures of Port_Cfg.h */",
+            "#if (PORT_AHB_PORTS_MASK != 0x%02XU)" % ahb_masks.pop(),
+            "  #error \"PORT_AHB_PORTS_MASK does not match the bus of Port_PBcfg.json\"",
+            "#endif",
+        ]
+    seen = set()
+    dio_pins = []
+    for variant in variants:
+        for pin in variant["pins"]:
+            if pin["dio"] and (pin["dio"], pin["port"], pin["channel"]) not in seen:
+                seen.add((pin["dio"], pin["port"], pin["channel"]))
+                dio_pins.append(pin)
+    if dio_pins:
+        lines += ["", "/* The Dio channels must be the pins the image was generated for */"]
+    for pin in dio_pins:
+        lines.append("PORT_PBCFG_STATIC_ASSERT((%s_PORT_NUM == %dU) && (%s_CHANNEL_NUM == %dU),"
+                     % (pin["dio"], pin["port"], pin["dio"], pin["channel"]))
+        lines.append("                         Port_PBcfg_%s_Matches_P%s%d);"
+                     % (pin["dio"], PORTS[pin["port"]], pin["channel"]))
+    return lines
+
+
+def emit_pin(pin, last):
+    if pin["dio"]:
+        port = "%s_PORT_NUM," % pin["dio"]
+        channel = "%s_CHANNEL_NUM," % pin["dio"]
+    else:
+        port = "%dU,%s/* PORT%s */" % (pin["port"], " " * 12, PORTS[pin["port"]])
+        channel = "%dU," % pin["channel"]
+    return [
+        "        PORT_CHANNEL(   /* %s: P%s%d */" % (pin["name"], PORTS[pin["port"]], pin["channel"]),
+        "            " + port,
+        "            " + channel,
+        "            %s," % MODES[pin["mode"]]["macro"],
+        "            %s," % DIRECTIONS[pin["direction"]],
+        "            %s," % LEVELS[pin["level"]],
+        "            %s," % ("TRUE" if pin["direction_changeable"] else "FALSE"),
+        "            %s," % ("TRUE" if pin["mode_changeable"] else "FALSE"),
+        "            %s," % RESISTORS[pin["resistor"]],
+        "            %s," % DRIVES[pin["drive"]],
+        "            %s," % ("TRUE" if pin["slew_rate"] else "FALSE"),
+        "            %s," % ("TRUE" if pin["open_drain"] else "FALSE"),
+        "            %s)%s" % (INTERRUPTS[pin["interrupt"]]["macro"], "" if last else ","),
+    ]
+
+
+def emit_image(port, image, last):
+    close = "        }" + ("" if last else ",")
+    if image["PinMask"] == 0:
+        return ["        {   /* PORT%s: not used */" % PORTS[port], "            0U", close]
+    lines = ["        {   /* PORT%s */" % PORTS[port]]
+    members = [(name, width) for name, width in IMAGE_FIELDS if image[name] != 0]
+    for index, (name, width) in enumerate(members):
+        value = "0x%0*XU" % (width // 4, image[name])
+        lines.append("            .%-18s = %s%s" % (name, value, "," if index + 1 < len(members) else ""))
+    lines.append(close)
+    return lines
+
+
+def emit_variant(variant):
+    lines = ["", "", "const Port_ConfigType %s =" % variant["name"], "{", "    .Pins =", "    {"]
+    pins = variant["pins"]
+    for index, pin in enumerate(pins):
+        lines += emit_pin(pin, index + 1 == len(pins))
+    lines += ["    },", "    .Ports =", "    {"]
+    for port, bus in enumerate(variant["buses"]):
+        sleep = "TRUE," if variant["sleep"][port] else "FALSE,"
+        deep_sleep = "TRUE " if variant["deep_sleep"][port] else "FALSE"
+        lines.append("        { %s, %-6s %s }%s   /* PORT%s */"
+                     % (bus, sleep, deep_sleep, " " if port + 1 == len(PORTS) else ",", PORTS[port]))
+    lines += ["    },", "    .Images =", "    {"]
+    for port, image in enumerate(variant["images"]):
+        lines += emit_image(port, image, port + 1 == len(PORTS))
+    lines += ["    },", "    .PinIds =", "    {"]
+    used = sorted({pin["port"] for pin in pins})
+    if not used:
+        lines.append("        { 0U }")
+    for index, port in enumerate(used):
+        entries = [pin for pin in pins if pin["port"] == port]
+        entries.sort(key=lambda pin: pin["channel"])
+        ids = ", ".join("[%d] = %dU" % (pin["channel"], pins.index(pin) + 1) for pin in entries)
+        names = ", ".join(pin["name"] for pin in entries)
+        lines.append("        [%d] = { %s }%s   /* PORT%s: %s */"
+                     % (port, ids, "," if index + 1 < len(used) else " ", PORTS[port], names))
+    parallel = variant["parallel_buses"]
+    if not parallel:
+        lines += ["    }", "};"]
+        return lines
+    lines += ["    },", "    .ParallelBuses =", "    {"]
+    for index, bus in enumerate(parallel):
+        pins = ", ".join("P%s%d" % (PORTS[bus["port"]], channel)
+                         for channel in range(PINS_PER_PORT) if bus["mask"] & (1 << channel))
+        lines.append("        { %dU, 0x%02XU, %dU }%s   /* %s: %s */"
+                     % (bus["port"], bus["mask"], bus["shift"],
+                        "," if index + 1 < len(parallel) else " ", bus["name"], pins))
+    lines += ["    }", "};"]
+    return lines
+
+
+def generate(variants):
+    lines = HEADER.split("\n")[:-1]
+    lines += emit_checks(variants)
+    for variant in variants:
+        lines += emit_variant(variant)
+    return "\r\n".join(lines) + "\r\n"
+
+
+def main():
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    parser = argparse.ArgumentParser(description="Generate Port_PBcfg.c from a pin description.")
+    parser.add_argument("description", nargs="?", default=os.path.join(root, "Port_PBcfg.json"))
+    parser.add_argument("-o", "--output", default=os.path.join(root, "Port_PBcfg.c"))
+    parser.add_argument("--device", choices=sorted(DEVICES),
+                        help="target device, overriding the one of the description")
+    parser.add_argument("--check", action="store_true",
+                        help="do not write, fail if the output is not up to date")
+    args = parser.parse_args()
+
+    try:
+        with open(args.description) as handle:
+            variants = parse_description(json.load(handle), args.device)
+    except (OSError, ValueError, ConfigError) as error:
+        sys.stderr.write("Port_Generator: %s\n" % error)
+        return 1
+
+    text = generate(variants)
+    if args.check:
+        try:
+            with open(args.output, newline="") as handle:
+                current = handle.read()
+        except OSError:
+            current = None
+        if current != text:
+            sys.stderr.write("Port_Generator: %s is not up to date\n" % args.output)
+            return 1
+        return 0
+
+    with open(args.output, "w", newline="") as handle:
+        handle.write(text)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())